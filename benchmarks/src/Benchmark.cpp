@@ -0,0 +1,181 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Benchmark.hpp"
+#include <atomic>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+namespace iklogbench
+{
+
+namespace
+{
+    constexpr double REPORTED_PERCENTILES[] = { 50.0, 90.0, 99.0, 99.9, 100.0 };
+
+    /*!
+     * \brief Writes a string as a JSON string, with its quotes
+     * \param stream The stream to write to
+     * \param text The string to write
+     */
+    void writeJsonString(std::ostream& stream, std::string_view text)
+    {
+        stream << '"';
+
+        for(const char character : text)
+        {
+            if(character == '"' || character == '\\')
+                stream << '\\' << character;
+            else if(static_cast<unsigned char>(character) < 0x20)
+                stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character)
+                       << std::dec << std::setfill(' ');
+            else
+                stream << character;
+        }
+
+        stream << '"';
+    }
+
+    /*!
+     * \brief Gives the key of a percentile in the report
+     * \param percentile The percentile
+     * \return "max" for the 100th percentile, "p" followed by the percentile otherwise
+     */
+    std::string getPercentileKey(double percentile)
+    {
+        if(percentile >= 100.0)
+            return "max";
+
+        std::ostringstream key;
+        key << 'p' << percentile;
+        return key.str();
+    }
+}
+
+std::string Scenario::getName() const
+{
+    return output + "/" + log + "/threads:" + std::to_string(threads) + "/" +
+           (levelEnabled ? "enabled" : "disabled") + "/format:" + format;
+}
+
+double Result::getThroughput() const
+{
+    const double seconds = std::chrono::duration<double>(duration).count();
+    return seconds > 0.0 ? static_cast<double>(messages) / seconds : 0.0;
+}
+
+Result run(const Scenario& scenario, const iklog::Log& log, uint64_t messagesPerThread, const std::function<void()>& finish)
+{
+    std::vector<std::unique_ptr<iklog::LatencyHistogram>> histograms;
+    std::vector<std::thread> threads;
+    std::atomic<unsigned int> readyThreads(0);
+    std::atomic<bool> started(false);
+
+    for(unsigned int i = 0 ; i < scenario.threads ; i++)
+        histograms.push_back(std::make_unique<iklog::LatencyHistogram>());
+
+    for(unsigned int i = 0 ; i < scenario.threads ; i++)
+    {
+        threads.emplace_back([&, i]()
+        {
+            iklog::LatencyHistogram& histogram = *histograms[i];
+
+            readyThreads.fetch_add(1, std::memory_order_release);
+            while(!started.load(std::memory_order_acquire))
+                std::this_thread::yield();
+
+            for(uint64_t messageIndex = 0 ; messageIndex < messagesPerThread ; messageIndex++)
+            {
+                const auto callStart = std::chrono::steady_clock::now();
+
+                // INFO is the only enabled level in the Log when the level is enabled
+                if(scenario.levelEnabled)
+                    log.info("benchmark message number {} from thread {}", messageIndex, i);
+                else
+                    log.debug("benchmark message number {} from thread {}", messageIndex, i);
+
+                const auto callDuration = std::chrono::steady_clock::now() - callStart;
+                histogram.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(callDuration).count()));
+            }
+        });
+    }
+
+    while(readyThreads.load(std::memory_order_acquire) < scenario.threads)
+        std::this_thread::yield();
+
+    const auto start = std::chrono::steady_clock::now();
+    started.store(true, std::memory_order_release);
+
+    for(std::thread& thread : threads)
+        thread.join();
+
+    finish();
+    const auto end = std::chrono::steady_clock::now();
+
+    Result result{ scenario, messagesPerThread * scenario.threads,
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(end - start), iklog::LatencyHistogram::Snapshot() };
+
+    for(const auto& histogram : histograms)
+        result.callLatency.merge(histogram->getSnapshot());
+
+    return result;
+}
+
+void writeJsonReport(std::ostream& stream, const std::vector<Result>& results, uint64_t messagesPerThread)
+{
+    stream << "{\n"
+           << "  \"library\": \"iklog\",\n"
+           << "  \"version\": \"" << IKLIBS_VERSION << "\",\n"
+           << "  \"hardwareThreads\": " << std::thread::hardware_concurrency() << ",\n"
+           << "  \"messagesPerThread\": " << messagesPerThread << ",\n"
+           << "  \"results\": [";
+
+    for(size_t i = 0 ; i < results.size() ; i++)
+    {
+        const Result& result = results[i];
+        const Scenario& scenario = result.scenario;
+
+        stream << (i == 0 ? "\n" : ",\n") << "    {\n      \"name\": ";
+        writeJsonString(stream, scenario.getName());
+        stream << ",\n      \"output\": ";
+        writeJsonString(stream, scenario.output);
+        stream << ",\n      \"log\": ";
+        writeJsonString(stream, scenario.log);
+        stream << ",\n      \"format\": ";
+        writeJsonString(stream, scenario.format);
+        stream << ",\n      \"threads\": " << scenario.threads
+               << ",\n      \"levelEnabled\": " << (scenario.levelEnabled ? "true" : "false")
+               << ",\n      \"messages\": " << result.messages
+               << ",\n      \"durationSeconds\": " << std::chrono::duration<double>(result.duration).count()
+               << ",\n      \"messagesPerSecond\": " << std::fixed << std::setprecision(0) << result.getThroughput()
+               << std::defaultfloat << std::setprecision(6)
+               << ",\n      \"callLatencyNanoseconds\": {\n        \"mean\": " << result.callLatency.getMean();
+
+        for(const double percentile : REPORTED_PERCENTILES)
+            stream << ",\n        \"" << getPercentileKey(percentile) << "\": " << result.callLatency.getPercentile(percentile);
+
+        stream << "\n      }\n    }";
+    }
+
+    stream << "\n  ]\n}" << std::endl;
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_BENCH_BENCHMARK_HPP
+#define IKLOG_BENCH_BENCHMARK_HPP
+
+#include <iklog/Log.hpp>
+#include <iklog/metrics/LatencyHistogram.hpp>
+#include <chrono>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace iklogbench
+{
+
+/*!
+ * \brief Configuration of a single benchmark run
+ */
+struct Scenario
+{
+    std::string output; //! name of the output receiving the messages
+    std::string log; //! type of the Log, "Log" or "AsyncLog"
+    std::string format; //! format given to the iklog::Formatter
+    unsigned int threads; //! number of threads logging at the same time
+    bool levelEnabled; //! whether the level of the messages is enabled in the Log
+
+    /*!
+     * \brief Gives a name identifying the scenario in the report and in the filter
+     * \return The name of the scenario
+     */
+    std::string getName() const;
+};
+
+/*!
+ * \brief Measures of a benchmark run
+ */
+struct Result
+{
+    Scenario scenario;
+    uint64_t messages; //! total number of messages logged by all the threads
+    std::chrono::nanoseconds duration; //! time from the start of the threads to the end of the delivery of the messages
+    iklog::LatencyHistogram::Snapshot callLatency; //! time spent in each logging call
+
+    /*!
+     * \brief Gives the number of messages logged per second
+     * \return The throughput of the run
+     */
+    double getThroughput() const;
+};
+
+/*!
+ * \brief Logs messages from several threads at the same time and measures the throughput and the latency of the calls
+ *
+ * The threads wait for each other before logging, each of them logs messagesPerThread messages with one argument.
+ * The finish function is called when all the threads are done and is included in the measured duration, it must
+ * make sure that all the messages have been delivered (flushing the outputs, destroying an asynchronous Log...).
+ * \param scenario The scenario that is run
+ * \param log The Log receiving the messages
+ * \param messagesPerThread The number of messages logged by each thread
+ * \param finish The function delivering the pending messages
+ * \return The measures of the run
+ */
+Result run(const Scenario& scenario, const iklog::Log& log, uint64_t messagesPerThread, const std::function<void()>& finish);
+
+/*!
+ * \brief Writes the results of the runs as a JSON document
+ * \param stream The stream to write to
+ * \param results The results to write
+ * \param messagesPerThread The number of messages logged by each thread in the runs
+ */
+void writeJsonReport(std::ostream& stream, const std::vector<Result>& results, uint64_t messagesPerThread);
+
+}
+
+#endif // IKLOG_BENCH_BENCHMARK_HPP
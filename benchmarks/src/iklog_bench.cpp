@@ -0,0 +1,296 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Benchmark.hpp"
+#include <iklog/AsyncLog.hpp>
+#include <iklog/outputs/DeduplicatingOutput.hpp>
+#include <iklog/outputs/FdRollingFileOutput.hpp>
+#include <iklog/outputs/FlightRecorderOutput.hpp>
+#include <iklog/outputs/MappedFileOutput.hpp>
+#include <iklog/outputs/OstreamWrapper.hpp>
+#include <iklog/outputs/RollingFileOutput.hpp>
+#include <iklog/outputs/ShardedOutput.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    constexpr uint64_t DEFAULT_MESSAGES_PER_THREAD = 100000;
+    constexpr unsigned int MAX_ROLLING_FILES = 2;
+    const iklog::MegaBytes MAX_FILE_SIZE(64);
+
+    const std::string DEFAULT_FORMAT = "%t %L [%p] %m";
+    const std::vector<std::string> FORMATS = { "%m", DEFAULT_FORMAT, "%U %L [%l] (%d) %m" };
+    const std::vector<std::string> OUTPUTS = { "OstreamWrapper", "RollingFileOutput", "FdRollingFileOutput", "MappedFileOutput",
+                                               "ShardedOutput", "DeduplicatingOutput", "FlightRecorderOutput" };
+
+    /*!
+     * \brief Outputs of a benchmark run, each output being able to write to the previous ones
+     */
+    class OutputChain
+    {
+        public:
+
+            OutputChain() = default;
+            OutputChain(const OutputChain&) = delete;
+            OutputChain& operator=(const OutputChain&) = delete;
+
+            /*!
+             * \brief Destructor, destroys the outputs from the last added to the first added
+             */
+            ~OutputChain()
+            {
+                while(!m_outputs.empty())
+                    m_outputs.pop_back();
+            }
+
+            template<typename T, typename... ARGS>
+            T& add(ARGS&&... arguments)
+            {
+                auto output = std::make_unique<T>(std::forward<ARGS>(arguments)...);
+                T& reference = *output;
+                m_outputs.push_back(std::move(output));
+                return reference;
+            }
+
+            /*!
+             * \brief Gives the output receiving the messages of the Log
+             * \return The last added output
+             */
+            inline iklog::Output& getOutput() { return *m_outputs.back(); }
+
+            std::ofstream m_stream; // file written by the OstreamWrapper
+
+        private:
+
+            std::vector<std::unique_ptr<iklog::Output>> m_outputs;
+    };
+
+    /*!
+     * \brief Creates the outputs needed by a scenario, throws std::runtime_error if a problem occurs
+     * \param name The name of the output receiving the messages
+     * \param directory The directory of the written files
+     * \param chain The chain receiving the outputs
+     */
+    void createOutputs(const std::string& name, const std::filesystem::path& directory, OutputChain& chain)
+    {
+        const std::string baseFilename = (directory / "bench.log").string();
+
+        if(name == "OstreamWrapper")
+        {
+            chain.m_stream.open(baseFilename);
+            if(!chain.m_stream)
+                throw std::runtime_error("Failed to open " + baseFilename);
+
+            chain.add<iklog::OstreamWrapper>(chain.m_stream);
+        }
+        else if(name == "RollingFileOutput")
+            chain.add<iklog::RollingFileOutput>(baseFilename, MAX_FILE_SIZE, MAX_ROLLING_FILES);
+        else if(name == "MappedFileOutput")
+            chain.add<iklog::MappedFileOutput>(baseFilename, MAX_FILE_SIZE, MAX_ROLLING_FILES);
+        else
+        {
+            // the other outputs are decorators, written to a file through a FdRollingFileOutput
+            iklog::Output& fileOutput = chain.add<iklog::FdRollingFileOutput>(baseFilename, MAX_FILE_SIZE, MAX_ROLLING_FILES);
+
+            if(name == "ShardedOutput")
+                chain.add<iklog::ShardedOutput>(fileOutput);
+            else if(name == "DeduplicatingOutput")
+                chain.add<iklog::DeduplicatingOutput>(fileOutput);
+            else if(name == "FlightRecorderOutput")
+                chain.add<iklog::FlightRecorderOutput>(fileOutput);
+            else if(name != "FdRollingFileOutput")
+                throw std::runtime_error("Unknown output " + name);
+        }
+    }
+
+    /*!
+     * \brief Runs a scenario with newly created outputs and Log, throws std::runtime_error if a problem occurs
+     * \param scenario The scenario to run
+     * \param directory The directory of the written files, emptied before the run
+     * \param messagesPerThread The number of messages logged by each thread
+     * \return The measures of the run
+     */
+    iklogbench::Result runScenario(const iklogbench::Scenario& scenario, const std::filesystem::path& directory,
+                                   uint64_t messagesPerThread)
+    {
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+
+        OutputChain chain;
+        createOutputs(scenario.output, directory, chain);
+
+        iklog::Output& output = chain.getOutput();
+        const iklog::Formatter formatter(scenario.format);
+        std::unique_ptr<iklog::Log> log;
+
+        if(scenario.log == "AsyncLog")
+            log = std::make_unique<iklog::AsyncLog>("bench", iklog::Level::INFO, output, formatter);
+        else
+            log = std::make_unique<iklog::Log>("bench", iklog::Level::INFO, output, formatter);
+
+        // destroying an AsyncLog writes the messages left in its queue
+        return iklogbench::run(scenario, *log, messagesPerThread, [&]() { log.reset(); output.flush(); });
+    }
+
+    /*!
+     * \brief Gives the thread counts of the runs: the powers of two up to the maximum, then the maximum
+     * \param maxThreads The maximum number of threads
+     * \return The thread counts
+     */
+    std::vector<unsigned int> getThreadCounts(unsigned int maxThreads)
+    {
+        std::vector<unsigned int> threadCounts;
+
+        for(unsigned int threads = 1 ; threads < maxThreads ; threads *= 2)
+            threadCounts.push_back(threads);
+
+        threadCounts.push_back(maxThreads);
+        return threadCounts;
+    }
+
+    /*!
+     * \brief Gives all the scenarios to run
+     * \param maxThreads The maximum number of threads
+     * \return The scenarios
+     */
+    std::vector<iklogbench::Scenario> getScenarios(unsigned int maxThreads)
+    {
+        std::vector<iklogbench::Scenario> scenarios;
+
+        for(const unsigned int threads : getThreadCounts(maxThreads))
+        {
+            for(const std::string& output : OUTPUTS)
+            {
+                for(const std::string& format : FORMATS)
+                    scenarios.push_back({ output, "Log", format, threads, true });
+            }
+
+            for(const std::string& format : FORMATS)
+                scenarios.push_back({ "FdRollingFileOutput", "AsyncLog", format, threads, true });
+
+            // a disabled level costs the same whatever the output and the format are
+            scenarios.push_back({ "OstreamWrapper", "Log", DEFAULT_FORMAT, threads, false });
+            scenarios.push_back({ "OstreamWrapper", "AsyncLog", DEFAULT_FORMAT, threads, false });
+        }
+
+        return scenarios;
+    }
+
+    void printUsage(const char* program)
+    {
+        std::cerr << "Usage: " << program << " [options]\n"
+                  << "  --messages <count>    messages logged by each thread (default " << DEFAULT_MESSAGES_PER_THREAD << ")\n"
+                  << "  --threads <count>     maximum number of logging threads (default: hardware threads)\n"
+                  << "  --filter <text>       only runs the scenarios whose name contains the text\n"
+                  << "  --directory <path>    directory of the written files, removed at the end (default: temporary directory)\n"
+                  << "  --output <file>       file receiving the JSON report (default: standard output)" << std::endl;
+    }
+}
+
+/*!
+ * \brief Measures the throughput and the call latency of iklog in many configurations, and reports them as JSON
+ *
+ * The progress is written to the standard error, the report to the standard output or to the file given with --output
+ */
+int main(int argc, char** argv)
+{
+    uint64_t messagesPerThread = DEFAULT_MESSAGES_PER_THREAD;
+    unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::string filter;
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "iklog_bench";
+    std::string reportFilename;
+
+    try
+    {
+        for(int i = 1 ; i < argc ; i++)
+        {
+            const std::string argument = argv[i];
+            if(i + 1 == argc)
+                throw std::invalid_argument("Missing value for " + argument);
+
+            const std::string value = argv[++i];
+
+            if(argument == "--messages")
+                messagesPerThread = std::stoull(value);
+            else if(argument == "--threads")
+                maxThreads = std::max(1u, static_cast<unsigned int>(std::stoul(value)));
+            else if(argument == "--filter")
+                filter = value;
+            else if(argument == "--directory")
+                directory = value;
+            else if(argument == "--output")
+                reportFilename = value;
+            else
+                throw std::invalid_argument("Unknown option " + argument);
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<iklogbench::Result> results;
+
+    try
+    {
+        for(const iklogbench::Scenario& scenario : getScenarios(maxThreads))
+        {
+            if(scenario.getName().find(filter) == std::string::npos)
+                continue;
+
+            results.push_back(runScenario(scenario, directory, messagesPerThread));
+
+            const iklogbench::Result& result = results.back();
+            std::cerr << scenario.getName() << ": " << static_cast<uint64_t>(result.getThroughput()) << " messages/s, p99 "
+                      << result.callLatency.getPercentile(99.0) << " ns" << std::endl;
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        std::filesystem::remove_all(directory);
+        return EXIT_FAILURE;
+    }
+
+    std::filesystem::remove_all(directory);
+
+    if(reportFilename.empty())
+        iklogbench::writeJsonReport(std::cout, results, messagesPerThread);
+    else
+    {
+        std::ofstream report(reportFilename);
+        iklogbench::writeJsonReport(report, results, messagesPerThread);
+
+        if(!report)
+        {
+            std::cerr << "Failed to write " << reportFilename << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
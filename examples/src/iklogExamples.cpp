@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2023, InternationalKoder
+    Copyright (C) 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -20,6 +20,8 @@
 #include "iklogExamples.hpp"
 
 #include <iklog/Log.hpp>
+#include <iklog/AsyncLog.hpp>
+#include <iklog/binary/BinaryLog.hpp>
 #include <iklog/outputs/RollingFileOutput.hpp>
 
 using namespace iklog::literals;
@@ -47,5 +49,15 @@ void runIklogExamples()
     iklog::Log rollingFileLog("rolling-file", iklog::Level::INFO, rollingFileOutput);
 
     for(unsigned int i = 0 ; i < 80 ; i++)
-        rollingFileLog.info("Line number " + std::to_string(i));
+        rollingFileLog.info("Line number {}", i);
+
+    // log from the calling thread, while formatting and writing are done by a dedicated thread
+    iklog::AsyncLog asyncLog("async", iklog::Level::INFO);
+    for(unsigned int i = 0 ; i < 5 ; i++)
+        asyncLog.info("Asynchronous line number {}", i);
+
+    // store messages in a compact binary file, the file can be turned into text with the iklog-decode tool
+    iklog::BinaryLog binaryLog("binary", iklog::Level::INFO, "examples.iklb");
+    for(unsigned int i = 0 ; i < 5 ; i++)
+        IKLOG_BINARY_LOG(binaryLog, iklog::Level::INFO, "Binary line number {}", i);
 }
@@ -0,0 +1,136 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_ASYNC_LOG_HPP
+#define IKLOG_ASYNC_LOG_HPP
+
+#include "Log.hpp"
+#include "iklog_export.hpp"
+#include <ikparll/BoundedMpscQueue.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace iklog
+{
+
+/*!
+ * \brief A Log that formats and writes its messages on a dedicated thread
+ *
+ * Logging a message only copies it into a bounded lock-free queue, the writer thread then formats it
+ * and writes it to the outputs. Messages still in the queue are written when the AsyncLog is destroyed.
+ */
+class AsyncLog : public Log
+{
+    public:
+
+        /*!
+         * \brief Defines what to do when a message is logged while the queue is full
+         */
+        enum class OverflowPolicy
+        {
+            BLOCK, //! wait for the writer thread to make room in the queue
+            DROP   //! discard the message
+        };
+
+        static constexpr size_t DEFAULT_QUEUE_CAPACITY = 8192; //! default maximum number of messages waiting to be written
+
+
+        /*!
+         * \brief Constructor
+         * \param name The name of the Log
+         * \param levels List of the enabled logging levels (flags)
+         * \param output The output that will be used for all levels
+         * \param formatter The formatter to use for the logging messages
+         * \param queueCapacity The maximum number of messages waiting to be written, rounded up to a power of two
+         * \param overflowPolicy What to do when a message is logged while the queue is full
+         */
+        IKLOG_EXPORT AsyncLog(const std::string& name, int levels, Output& output = DEFAULT_OUTPUT,
+                              const Formatter& formatter = Formatter(), size_t queueCapacity = DEFAULT_QUEUE_CAPACITY,
+                              OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK);
+
+        /*!
+         * \brief Destructor, writes the remaining messages then stops the writer thread
+         */
+        IKLOG_EXPORT virtual ~AsyncLog();
+
+
+        /*!
+         * \brief Gives the number of messages discarded because the queue was full
+         * \return The number of dropped messages
+         */
+        inline uint64_t getDroppedCount() const { return m_metrics.getDroppedCount(); }
+
+    protected:
+
+        /*!
+         * \brief Queues a message to be written in the given level
+         * \param level The level of the logging message
+         * \param message The message to log
+         * \param fields The structured fields of the message, copied with their strings into the queue
+         */
+        IKLOG_EXPORT virtual void doLog(Level level, std::string_view message, std::span<const Field> fields) const override;
+
+    private:
+
+        static constexpr unsigned int IDLE_SPIN_COUNT = 64; // number of empty polls before the writer thread goes to sleep
+        static constexpr std::chrono::milliseconds IDLE_WAIT_TIMEOUT{10}; // maximum sleep time, in case a wake up notification is missed
+
+        /*!
+         * \brief A message waiting to be formatted and written
+         */
+        struct Record
+        {
+            Level level = Level::INFO;
+            Message::TimePoint clockTime;
+            std::string message; // reused from one message to another, so its capacity is allocated only once
+            std::string fieldStrings; // keys and string values of the fields, referred to by the fields
+            std::vector<Field> fields;
+            ThreadContext threadContext; // copy of the context of the thread, only updated when its version changes
+        };
+
+
+        /*!
+         * \brief Copies fields into a record, with their keys and string values
+         * \param fields The fields to copy
+         * \param record [out] The record receiving the fields
+         */
+        static void copyFields(std::span<const Field> fields, Record& record);
+
+
+        /*!
+         * \brief Runs the writer thread
+         */
+        void run();
+
+
+        mutable ikparll::BoundedMpscQueue<Record> m_queue; // messages waiting to be written
+        const OverflowPolicy m_overflowPolicy;
+
+        std::atomic<bool> m_running; // stops the writer thread when set to false
+        mutable std::atomic<bool> m_writerSleeping; // tells the producers that the writer thread needs a notification
+        mutable std::mutex m_wakeUpMutex;
+        mutable std::condition_variable m_wakeUp; // wakes the writer thread up when a message is queued
+        std::thread m_writerThread;
+};
+
+}
+
+#endif // IKLOG_ASYNC_LOG_HPP
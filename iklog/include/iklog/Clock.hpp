@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_CLOCK_HPP
+#define IKLOG_CLOCK_HPP
+
+#include "iklog_export.hpp"
+#include <chrono>
+
+namespace iklog
+{
+
+/*!
+ * \brief Source of the timestamps of the log messages
+ *
+ * A Log reads its clock once per message. The system clock is the most precise, the other clocks give up some
+ * precision for a cheaper reading:
+ * - the coarse real time clock is only updated at each scheduler tick, usually every 1 to 4 milliseconds
+ * - the time stamp counter clock reads the TSC of the CPU, converted to a clock time with a rate measured once
+ *   and a reference system time read again by each thread every second, so the timestamps of two threads may
+ *   differ by a few microseconds
+ */
+class Clock
+{
+    public:
+
+        using TimePoint = std::chrono::system_clock::time_point;
+
+
+        /*!
+         * \brief Gives the clock reading std::chrono::system_clock, this is the default clock of the logs
+         * \return The clock
+         */
+        IKLOG_EXPORT static Clock system();
+
+        /*!
+         * \brief Gives the clock reading CLOCK_REALTIME_COARSE, or the system clock where it is not available
+         * \return The clock
+         */
+        IKLOG_EXPORT static Clock realtimeCoarse();
+
+        /*!
+         * \brief Gives the clock reading the time stamp counter, or the system clock if the CPU has no invariant TSC
+         *
+         * The rate of the counter is measured the first time this function is called, which takes about 10 milliseconds
+         * \return The clock
+         */
+        IKLOG_EXPORT static Clock timeStampCounter();
+
+        /*!
+         * \brief Tells whether the CPU has a time stamp counter with a constant rate, usable by timeStampCounter()
+         * \return True if the time stamp counter can be used
+         */
+        IKLOG_EXPORT static bool isTimeStampCounterAvailable();
+
+
+        /*!
+         * \brief Reads the clock
+         * \return The current time
+         */
+        inline TimePoint now() const { return m_now(); }
+
+    private:
+
+        typedef TimePoint(*nowFunc)(); // pointer to the functions reading a clock
+
+        explicit Clock(nowFunc now) : m_now(now) {}
+
+        nowFunc m_now;
+};
+
+}
+
+#endif // IKLOG_CLOCK_HPP
@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_FIELD_HPP
+#define IKLOG_FIELD_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace iklog
+{
+
+namespace internal
+{
+    template<typename T>
+    inline constexpr bool UNSUPPORTED_FIELD = false; // delays the failure of the static_assert to the instantiation
+}
+
+/*!
+ * \brief A typed key-value pair attached to a log message, for structured logging
+ *
+ * The key and string values are not copied: like a Message, a Field only refers to them, so the strings must live
+ * until the logging call returns. Fields are rendered as JSON members or logfmt pairs by the iklog::Formatter
+ */
+class Field
+{
+    public:
+
+        using Value = std::variant<std::string_view, int64_t, uint64_t, double, bool>;
+
+        /*!
+         * \brief Constructor
+         *
+         * Supported types are booleans, integers, floating point numbers, enumerations (their underlying value)
+         * and anything convertible to a std::string_view
+         * \param key The name of the field
+         * \param value The value of the field
+         */
+        template<typename T>
+        Field(std::string_view key, const T& value) :
+            m_key(key),
+            m_value(toValue(value))
+        {}
+
+        inline std::string_view getKey() const { return m_key; }
+        inline const Value& getValue() const { return m_value; }
+
+    private:
+
+        /*!
+         * \brief Converts a value to the type stored by the field
+         * \param value The value to convert
+         * \return The stored value
+         */
+        template<typename T>
+        static Value toValue(const T& value)
+        {
+            if constexpr(std::is_same_v<T, Value> || std::is_same_v<T, bool>)
+                return value;
+            else if constexpr(std::is_integral_v<T> && std::is_signed_v<T>)
+                return static_cast<int64_t>(value);
+            else if constexpr(std::is_integral_v<T>)
+                return static_cast<uint64_t>(value);
+            else if constexpr(std::is_floating_point_v<T>)
+                return static_cast<double>(value);
+            else if constexpr(std::is_enum_v<T>)
+                return toValue(static_cast<std::underlying_type_t<T>>(value));
+            else if constexpr(std::is_convertible_v<const T&, std::string_view>)
+                return std::string_view(value);
+            else
+                static_assert(internal::UNSUPPORTED_FIELD<T>, "Unsupported type for a log field value");
+        }
+
+        std::string_view m_key;
+        Value m_value;
+};
+
+}
+
+#endif // IKLOG_FIELD_HPP
@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, 2023, InternationalKoder
+    Copyright (C) 2019, 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -22,6 +22,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include "Message.hpp"
 #include "iklog_export.hpp"
 
@@ -38,17 +39,47 @@ namespace iklog
  * - %m log message
  * - %d duration from the creation of the iklog::Log object
  * - %t current clock time
+ * - %T current clock time with milliseconds
+ * - %U current clock time with microseconds
+ * - %F structured fields of the message, as logfmt pairs
+ * - %i identifier of the thread that logged the message
+ * - %n name of the thread that logged the message, see iklog::ThreadContext
+ * - %X entries of the context of the thread that logged the message, as logfmt pairs
+ *
+ * The format is parsed once when it is given to the Formatter, and compiled into a list of segments
+ * (literal texts and fields) that are appended one after the other when a message is formatted.
+ * A '%' that is not followed by one of the characters above is kept as is.
+ *
+ * Instead of a format, a Formatter can write each message as a JSON object or as logfmt pairs, with the UTC time,
+ * the level, the Log name, the thread, the message text, the thread context and the structured fields,
+ * for log pipelines that parse the messages
  */
 class Formatter
 {
     public:
 
+        /*!
+         * \brief Defines how the messages are written
+         */
+        enum class Style
+        {
+            TEXT,  //! the format given to the Formatter
+            JSON,  //! a JSON object on a single line: {"time":"...","level":"...","log":"...","thread":...,"threadName":"...","msg":"...",context...,fields...}
+            LOGFMT //! key=value pairs: time=... level=... log=... thread=... threadName=... msg=... context... fields...
+        };
+
         /*!
          * \brief Constructor taking a format as a std::string
          * \param format The format to use for all the messages
          */
         IKLOG_EXPORT Formatter(const std::string& format = "%t %L [%p] %m");
 
+        /*!
+         * \brief Constructor taking a style, the TEXT style using the default format
+         * \param style The way the messages are written
+         */
+        IKLOG_EXPORT explicit Formatter(Style style);
+
 
         /*!
          * \brief Applies the format to the given message
@@ -57,23 +88,106 @@ class Formatter
          */
         IKLOG_EXPORT std::string format(const Message& message) const;
 
+        /*!
+         * \brief Applies the format to the given message, and appends the result to a string
+         * \param message The log message to format
+         * \param output [out] The string the formatted message is appended to
+         */
+        IKLOG_EXPORT void format(const Message& message, std::string& output) const;
+
 
-        static inline std::string getLogName(const Message& message) { return message.getLogName(); }
+        static inline std::string getLogName(const Message& message) { return std::string(message.getLogName()); }
         IKLOG_EXPORT static std::string getLevel(const Message& message);
         IKLOG_EXPORT static std::string getLevelPretty(const Message& message);
-        static inline std::string getMessage(const Message& message) { return message.getMessage(); }
+        static inline std::string getMessage(const Message& message) { return std::string(message.getMessage()); }
         IKLOG_EXPORT static std::string getProgramDuration(const Message& message);
         IKLOG_EXPORT static std::string getClockTime(const Message& message);
 
-        inline void setFormat(const std::string& format) { m_format = format; }
+        IKLOG_EXPORT void setFormat(const std::string& format);
+
+        inline Style getStyle() const { return m_style; }
 
     private:
 
-        typedef std::string(*getFunc)(const Message&); // pointer to the getter methods
+        typedef void(*appendFunc)(const Message&, std::string&); // pointer to the methods appending a field to a string
+
+        /*!
+         * \brief Part of a compiled format: either a literal text from the format, or a field
+         */
+        struct Segment
+        {
+            appendFunc append; // appends the field, or nullptr for a literal text
+            std::string::size_type literalStart; // position of the literal text in the format
+            std::string::size_type literalLength; // length of the literal text
+        };
+
+        static const std::map<char, appendFunc> FORMAT_MAPPING; // mapping from the fields of the format to the append methods
+
+        static constexpr std::string::size_type FIELDS_RESERVE = 64; // estimated size of the fields other than the message, to reserve the output
 
-        static const std::map<char, getFunc> FORMAT_MAPPING; // mapping from the fields of the format to the getters
+        /*!
+         * \brief Parses the format and builds the list of segments from it
+         */
+        void compile();
+
+        static inline void appendLogName(const Message& message, std::string& output) { output += message.getLogName(); }
+        static void appendLevel(const Message& message, std::string& output);
+        static void appendLevelPretty(const Message& message, std::string& output);
+        static inline void appendMessage(const Message& message, std::string& output) { output += message.getMessage(); }
+        static void appendProgramDuration(const Message& message, std::string& output);
+        static void appendClockTime(const Message& message, std::string& output);
+        static void appendClockTimeMillis(const Message& message, std::string& output);
+        static void appendClockTimeMicros(const Message& message, std::string& output);
+        static void appendFields(const Message& message, std::string& output);
+        static inline void appendThreadId(const Message& message, std::string& output) { output += message.getThreadContext().getThreadId(); }
+        static inline void appendThreadName(const Message& message, std::string& output) { output += message.getThreadContext().getThreadName(); }
+        static inline void appendThreadEntries(const Message& message, std::string& output) { output += message.getThreadContext().getLogfmtEntries(); }
+
+        /*!
+         * \brief Appends a message as a JSON object
+         * \param message The message to append
+         * \param output [out] The string the JSON object is appended to
+         */
+        static void appendJson(const Message& message, std::string& output);
+
+        /*!
+         * \brief Appends a message as logfmt pairs
+         * \param message The message to append
+         * \param output [out] The string the pairs are appended to
+         */
+        static void appendLogfmt(const Message& message, std::string& output);
+
+        /*!
+         * \brief Appends the clock time of the message in UTC, in the RFC 3339 format with microseconds
+         *
+         * Like the local time, the rendering of the last second is cached for each thread
+         * \param message The message from which the clock time is taken
+         * \param output [out] The string the clock time is appended to
+         */
+        static void appendUtcTime(const Message& message, std::string& output);
+
+        /*!
+         * \brief Appends the clock time of the message truncated to the second
+         *
+         * The rendering of the last second is cached for each thread, so the conversion to local time is only done
+         * once per second and thread instead of once per message
+         * \param message The message from which the clock time is taken
+         * \param output [out] The string the clock time is appended to
+         */
+        static void appendClockSeconds(const Message& message, std::string& output);
+
+        /*!
+         * \brief Appends the fraction of second of the clock time of the message, as a '.' followed by a fixed number of digits
+         * \param message The message from which the clock time is taken
+         * \param output [out] The string the fraction of second is appended to
+         */
+        template<typename D>
+        static void appendClockSubSeconds(const Message& message, std::string& output);
 
-        std::string m_format; // the format to apply to all the messages
+        Style m_style;
+        std::string m_format; // the format to apply to all the messages, with the TEXT style
+        std::vector<Segment> m_segments; // the compiled format
+        std::string::size_type m_literalLength; // total length of the literal texts of the format
 };
 
 }
@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, InternationalKoder
+    Copyright (C) 2019, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -20,6 +20,9 @@
 #ifndef IKLOG_LEVELS_HPP
 #define IKLOG_LEVELS_HPP
 
+#include <bit>
+#include <cstddef>
+
 namespace iklog
 {
     /*!
@@ -32,6 +35,64 @@ namespace iklog
         WARNING = 0x0100,
         ERROR   = 0x1000
     };
+
+
+#ifndef IKLOG_MIN_LEVEL
+#define IKLOG_MIN_LEVEL DEBUG
+#endif
+
+    /*!
+     * \brief Minimum level compiled in the program, set with the IKLOG_MIN_LEVEL definition (e.g. -DIKLOG_MIN_LEVEL=WARNING)
+     *
+     * Levels are ordered from the least to the most severe: DEBUG, INFO, WARNING, ERROR.
+     * Logging calls with a level below the minimum are removed at compile time
+     */
+    static constexpr Level MIN_LEVEL = Level::IKLOG_MIN_LEVEL;
+
+    /*!
+     * \brief Gives the levels that are at least as severe as the given one
+     * \param minLevel The least severe level to include
+     * \return The flags of the levels
+     */
+    inline constexpr int levelsFrom(Level minLevel)
+    {
+        switch(minLevel)
+        {
+            case Level::DEBUG:
+                return Level::DEBUG | Level::INFO | Level::WARNING | Level::ERROR;
+            case Level::INFO:
+                return Level::INFO | Level::WARNING | Level::ERROR;
+            case Level::WARNING:
+                return Level::WARNING | Level::ERROR;
+            case Level::ERROR:
+                return Level::ERROR;
+        }
+
+        return 0;
+    }
+
+    static constexpr int COMPILED_LEVELS = levelsFrom(MIN_LEVEL); //! levels that are not removed at compile time
+
+    /*!
+     * \brief Tells whether logging calls in a level are kept at compile time
+     * \param level The level to check
+     * \return True if the level is at least as severe as the minimum compiled level
+     */
+    inline constexpr bool isLevelCompiled(Level level) { return (COMPILED_LEVELS & level) != 0; }
+
+
+    static constexpr std::size_t LEVEL_COUNT = 4; //! number of logging levels
+
+    /*!
+     * \brief Gives the position of a level, to store data per level in an array of LEVEL_COUNT elements
+     * \param level The level to locate
+     * \return The index of the level, from 0 to LEVEL_COUNT - 1
+     */
+    inline constexpr std::size_t getLevelIndex(Level level)
+    {
+        // each level is a single bit, in its own hexadecimal digit
+        return static_cast<std::size_t>(std::countr_zero(static_cast<unsigned int>(level))) / 4;
+    }
 }
 
 #endif // IKLOG_LEVELS_HPP
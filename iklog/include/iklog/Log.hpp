@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, 2020, 2023, InternationalKoder
+    Copyright (C) 2019, 2020, 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -21,19 +21,37 @@
 #define IKLOG_LOG_HPP
 
 #include "Level.hpp"
+#include "Clock.hpp"
+#include "Field.hpp"
 #include "Formatter.hpp"
+#include "RateLimiter.hpp"
+#include "metrics/LogMetrics.hpp"
+#include "MessageFormat.hpp"
 #include "outputs/Output.hpp"
 #include "iklog/outputs/OstreamWrapper.hpp"
-#include <map>
+#include <array>
+#include <vector>
 #include <chrono>
+#include <concepts>
+#include <initializer_list>
+#include <span>
+#include <string_view>
 #include <iostream>
 #include "iklog_export.hpp"
 
 namespace iklog
 {
 
+namespace internal
+{
+    struct LogSlot;
+}
+
 /*!
  * \brief Allows to log a message
+ *
+ * Each Log is registered with its name, to be found by getLog or a LogHandle. A Log created with the name
+ * of an existing one replaces it in the registry
  */
 class Log
 {
@@ -58,40 +76,280 @@ class Log
          * \param level The level of the logging message
          * \param message The message to log
          */
-        IKLOG_EXPORT virtual void log(Level level, const std::string& message) const;
+        IKLOG_EXPORT void log(Level level, std::string_view message) const;
+
+        /*!
+         * \brief Logs a message built from a format and arguments in the given level
+         *
+         * Each "{}" in the format is replaced by the next argument. The message is rendered in a buffer
+         * owned by the calling thread, so no std::string has to be built by the caller
+         * \param level The level of the logging message
+         * \param format The format of the message
+         * \param argument The value replacing the first "{}" of the format
+         * \param arguments The values replacing the next "{}" of the format
+         */
+        template<typename ARG, typename... ARGS>
+        void log(Level level, std::string_view format, const ARG& argument, const ARGS&... arguments) const
+        {
+            if(!isLevelEnabled(level) || !isAllowedByRateLimiter(level))
+                return;
+
+            std::string& buffer = internal::getMessageBuffer();
+            internal::formatMessage(buffer, format, argument, arguments...);
+            logAdmitted(level, std::string_view(buffer));
+        }
+
+
+        /*!
+         * \brief Logs a message with structured fields in the given level
+         *
+         * The fields are written by the formatter, as JSON members, logfmt pairs or with the %F field of a format
+         * \param level The level of the logging message
+         * \param message The message to log
+         * \param fields The fields of the message, e.g. {{"status", 200}, {"path", path}}
+         */
+        inline void log(Level level, std::string_view message, std::initializer_list<Field> fields) const
+        {
+            logFields(level, message, std::span<const Field>(fields.begin(), fields.size()));
+        }
+
+        /*!
+         * \brief Logs a message with structured fields in the given level, the fields being built beforehand
+         * \param level The level of the logging message
+         * \param message The message to log
+         * \param fields The fields of the message
+         */
+        inline void logFields(Level level, std::string_view message, std::span<const Field> fields) const
+        {
+            if(isLevelEnabled(level) && isAllowedByRateLimiter(level))
+                logAdmitted(level, message, fields);
+        }
+
+
+        /*!
+         * \brief Logs a message in the given level, the message is only built if the level is enabled
+         * \param level The level of the logging message
+         * \param messageProducer Function returning the message to log, called only if the level is enabled
+         */
+        template<std::invocable F>
+        void log(Level level, F&& messageProducer) const
+        {
+            if(isLevelEnabled(level) && isAllowedByRateLimiter(level))
+                logAdmitted(level, std::string_view(std::forward<F>(messageProducer)()));
+        }
+
+
+        /*!
+         * \brief Logs a message in the given level if the given limiter lets it through, usually through IKLOG_LOG_LIMITED
+         *
+         * The limiter is checked before the rate limiter of the level, and before the message is built
+         * \param limiter The limiter of the call site
+         * \param level The level of the logging message
+         * \param arguments The message, a format followed by its arguments, or a function giving the message
+         */
+        template<typename... ARGS>
+        void logLimited(RateLimiter& limiter, Level level, ARGS&&... arguments) const
+        {
+            if(isLevelEnabled(level) && acquire(limiter, level))
+                log(level, std::forward<ARGS>(arguments)...);
+        }
 
 
         /*!
          * \brief Logs a message in INFO level
          * \param message The message to log
          */
-        inline void info(const std::string& message) const { log(Level::INFO, message); }
+        inline void info(std::string_view message) const
+        {
+            if constexpr(isLevelCompiled(Level::INFO))
+            {
+                if(isLevelEnabled(Level::INFO))
+                    log(Level::INFO, message);
+            }
+        }
+
+        /*!
+         * \brief Logs a message built from a format and arguments in INFO level
+         * \param format The format of the message, each "{}" is replaced by the next argument
+         * \param arguments The values replacing the "{}" of the format
+         */
+        template<typename ARG, typename... ARGS>
+        inline void info(std::string_view format, const ARG& argument, const ARGS&... arguments) const
+        {
+            if constexpr(isLevelCompiled(Level::INFO))
+                log(Level::INFO, format, argument, arguments...);
+        }
+
+        /*!
+         * \brief Logs a message with structured fields in INFO level
+         * \param message The message to log
+         * \param fields The fields of the message, e.g. {{"status", 200}, {"path", path}}
+         */
+        inline void info(std::string_view message, std::initializer_list<Field> fields) const
+        {
+            if constexpr(isLevelCompiled(Level::INFO))
+                log(Level::INFO, message, fields);
+        }
+
+        /*!
+         * \brief Logs a message in INFO level, the message is only built if the level is enabled
+         * \param messageProducer Function returning the message to log, called only if the level is enabled
+         */
+        template<std::invocable F>
+        inline void info(F&& messageProducer) const
+        {
+            if constexpr(isLevelCompiled(Level::INFO))
+                log(Level::INFO, std::forward<F>(messageProducer));
+        }
 
         /*!
          * \brief Logs a message in DEBUG level
          * \param message The message to log
          */
-        inline void debug(const std::string& message) const { log(Level::DEBUG, message); }
+        inline void debug(std::string_view message) const
+        {
+            if constexpr(isLevelCompiled(Level::DEBUG))
+            {
+                if(isLevelEnabled(Level::DEBUG))
+                    log(Level::DEBUG, message);
+            }
+        }
+
+        /*!
+         * \brief Logs a message built from a format and arguments in DEBUG level
+         * \param format The format of the message, each "{}" is replaced by the next argument
+         * \param arguments The values replacing the "{}" of the format
+         */
+        template<typename ARG, typename... ARGS>
+        inline void debug(std::string_view format, const ARG& argument, const ARGS&... arguments) const
+        {
+            if constexpr(isLevelCompiled(Level::DEBUG))
+                log(Level::DEBUG, format, argument, arguments...);
+        }
+
+        /*!
+         * \brief Logs a message with structured fields in DEBUG level
+         * \param message The message to log
+         * \param fields The fields of the message, e.g. {{"status", 200}, {"path", path}}
+         */
+        inline void debug(std::string_view message, std::initializer_list<Field> fields) const
+        {
+            if constexpr(isLevelCompiled(Level::DEBUG))
+                log(Level::DEBUG, message, fields);
+        }
+
+        /*!
+         * \brief Logs a message in DEBUG level, the message is only built if the level is enabled
+         * \param messageProducer Function returning the message to log, called only if the level is enabled
+         */
+        template<std::invocable F>
+        inline void debug(F&& messageProducer) const
+        {
+            if constexpr(isLevelCompiled(Level::DEBUG))
+                log(Level::DEBUG, std::forward<F>(messageProducer));
+        }
 
         /*!
          * \brief Logs a message in WARNING level
          * \param message The message to log
          */
-        inline void warn(const std::string& message) const { log(Level::WARNING, message); }
+        inline void warn(std::string_view message) const
+        {
+            if constexpr(isLevelCompiled(Level::WARNING))
+            {
+                if(isLevelEnabled(Level::WARNING))
+                    log(Level::WARNING, message);
+            }
+        }
+
+        /*!
+         * \brief Logs a message built from a format and arguments in WARNING level
+         * \param format The format of the message, each "{}" is replaced by the next argument
+         * \param arguments The values replacing the "{}" of the format
+         */
+        template<typename ARG, typename... ARGS>
+        inline void warn(std::string_view format, const ARG& argument, const ARGS&... arguments) const
+        {
+            if constexpr(isLevelCompiled(Level::WARNING))
+                log(Level::WARNING, format, argument, arguments...);
+        }
+
+        /*!
+         * \brief Logs a message with structured fields in WARNING level
+         * \param message The message to log
+         * \param fields The fields of the message, e.g. {{"status", 200}, {"path", path}}
+         */
+        inline void warn(std::string_view message, std::initializer_list<Field> fields) const
+        {
+            if constexpr(isLevelCompiled(Level::WARNING))
+                log(Level::WARNING, message, fields);
+        }
+
+        /*!
+         * \brief Logs a message in WARNING level, the message is only built if the level is enabled
+         * \param messageProducer Function returning the message to log, called only if the level is enabled
+         */
+        template<std::invocable F>
+        inline void warn(F&& messageProducer) const
+        {
+            if constexpr(isLevelCompiled(Level::WARNING))
+                log(Level::WARNING, std::forward<F>(messageProducer));
+        }
 
         /*!
          * \brief Logs a message in ERROR level
          * \param message The message to log
          */
-        inline void error(const std::string& message) const { log(Level::ERROR, message); }
+        inline void error(std::string_view message) const
+        {
+            if constexpr(isLevelCompiled(Level::ERROR))
+            {
+                if(isLevelEnabled(Level::ERROR))
+                    log(Level::ERROR, message);
+            }
+        }
+
+        /*!
+         * \brief Logs a message built from a format and arguments in ERROR level
+         * \param format The format of the message, each "{}" is replaced by the next argument
+         * \param arguments The values replacing the "{}" of the format
+         */
+        template<typename ARG, typename... ARGS>
+        inline void error(std::string_view format, const ARG& argument, const ARGS&... arguments) const
+        {
+            if constexpr(isLevelCompiled(Level::ERROR))
+                log(Level::ERROR, format, argument, arguments...);
+        }
+
+        /*!
+         * \brief Logs a message with structured fields in ERROR level
+         * \param message The message to log
+         * \param fields The fields of the message, e.g. {{"status", 200}, {"path", path}}
+         */
+        inline void error(std::string_view message, std::initializer_list<Field> fields) const
+        {
+            if constexpr(isLevelCompiled(Level::ERROR))
+                log(Level::ERROR, message, fields);
+        }
+
+        /*!
+         * \brief Logs a message in ERROR level, the message is only built if the level is enabled
+         * \param messageProducer Function returning the message to log, called only if the level is enabled
+         */
+        template<std::invocable F>
+        inline void error(F&& messageProducer) const
+        {
+            if constexpr(isLevelCompiled(Level::ERROR))
+                log(Level::ERROR, std::forward<F>(messageProducer));
+        }
 
 
         /*!
-         * \brief Checks whether a level is enabled for this Log
+         * \brief Checks whether a level is enabled for this Log, and not removed at compile time
          * \param level The level to check
          * \return True if the level is enabled
          */
-        inline bool isLevelEnabled(Level level) const { return (m_levels & level) != 0; }
+        inline bool isLevelEnabled(Level level) const { return (COMPILED_LEVELS & m_levels & level) != 0; }
 
 
         /*!
@@ -109,52 +367,248 @@ class Log
 
         /*!
          * \brief Gives the Log object having a specific name, or the iklog::NullLog if no Log has the given name
+         *
+         * The lookup does not take any lock, but a LogHandle avoids it entirely for code logging often
          * \param name The name of the Log to fetch
          * \return The Log with the given name if it has been found
          */
-        IKLOG_EXPORT static Log* getLog(const std::string& name);
+        IKLOG_EXPORT static Log* getLog(std::string_view name);
 
 
         /*!
-         * \brief Changes the output for a specific level
+         * \brief Changes the output for a specific level, replacing all the outputs of this level
          * \param level The level that will have a new output
          * \param output The output to use
          */
-        inline void setOutput(Level level, Output& output) { m_outputs[level] = &output; }
+        inline void setOutput(Level level, Output& output) { m_outputs[getLevelIndex(level)].assign(1, &output); }
 
         /*!
-         * \brief Changes the output for all levels
+         * \brief Changes the output for all levels, replacing all the outputs of the Log
          * \param output The output to use
          */
         void setOutput(Output& output)
         {
-            for(const auto& outputEntry: m_outputs)
-                m_outputs[outputEntry.first] = &output;
+            for(std::vector<Output*>& levelOutputs : m_outputs)
+                levelOutputs.assign(1, &output);
         }
 
+        /*!
+         * \brief Adds an output to some levels, keeping the outputs they already have
+         *
+         * A message is formatted once, then written to each output of its level in the order they were added
+         * \param output The output to add
+         * \param levels List of flags describing the levels that will write to the output
+         */
+        IKLOG_EXPORT void addOutput(Output& output, int levels = levelsFrom(Level::DEBUG));
+
+        /*!
+         * \brief Removes an output from all the levels it has been set to
+         * \param output The output to remove
+         */
+        IKLOG_EXPORT void removeOutput(Output& output);
+
+
+        /*!
+         * \brief Limits the number of messages logged in some levels, replacing their previous limiter
+         *
+         * The limiter is not copied, so it must live as long as it is used by this Log. It can be shared by several levels
+         * or Logs, their messages then being counted together. Besides the summaries written before the messages let
+         * through, a background thread writes the pending summaries at each summary interval, and the remaining ones
+         * are written when the Log is destroyed
+         * \param limiter The limiter to use
+         * \param levels List of flags describing the levels to limit
+         */
+        IKLOG_EXPORT void setRateLimiter(RateLimiter& limiter, int levels = levelsFrom(Level::DEBUG));
+
+        /*!
+         * \brief Removes the limiter of some levels
+         * \param levels List of flags describing the levels that will not be limited anymore
+         */
+        IKLOG_EXPORT void removeRateLimiter(int levels = levelsFrom(Level::DEBUG));
+
 
         inline void setFormatter(const Formatter& formatter) { m_formatter = formatter; }
 
+        /*!
+         * \brief Changes the clock giving the timestamps of the messages, read once per message. The start time of the Log
+         * is moved to the new clock, keeping the duration elapsed since the creation of the Log
+         * \param clock The clock to use, e.g. iklog::Clock::realtimeCoarse() for a cheaper and less precise timestamp
+         */
+        IKLOG_EXPORT void setClock(const Clock& clock);
+
+
+        /*!
+         * \brief Gives the values of the counters of the Log: messages per level, suppressed and dropped messages, and log latency
+         * \return The snapshot of the counters
+         */
+        inline LogMetrics::Snapshot getMetrics() const { return m_metrics.getSnapshot(); }
+
+        /*!
+         * \brief Sets whether the time spent logging each message is measured, disabled by default
+         * \param track True to measure the log latency
+         */
+        inline void setLatencyTracking(bool track) { m_metrics.setLatencyTracking(track); }
+
     protected:
 
+        /*!
+         * \brief Logs a message that has passed the level and rate limiting checks
+         * \param level The level of the logging message
+         * \param message The message to log
+         * \param fields The structured fields of the message, may be empty
+         */
+        IKLOG_EXPORT virtual void doLog(Level level, std::string_view message, std::span<const Field> fields) const;
+
+        /*!
+         * \brief Stops writing the summaries of the rate limiters in the background, then writes their remaining summaries
+         *
+         * Must be called at the beginning of the destructor of the Logs overriding doLog, so the background thread
+         * does not log to a Log being destroyed, and the remaining summaries go through the overridden doLog
+         */
+        IKLOG_EXPORT void stopRateLimiterSummaries();
+
+        /*!
+         * \brief Tells whether the rate limiter of a level, if any, lets a new message through
+         * \param level The level of the logging message
+         * \return True if the message can be logged
+         */
+        inline bool isAllowedByRateLimiter(Level level) const
+        {
+            RateLimiter* const limiter = m_rateLimiters[getLevelIndex(level)];
+            return limiter == nullptr || acquire(*limiter, level);
+        }
+
+        /*!
+         * \brief Formats the given message and writes it to the outputs of its level
+         * \param message The message to write
+         */
+        IKLOG_EXPORT void write(const Message& message) const;
+
+        inline const std::string& getName() const { return m_name; }
+        inline const std::chrono::system_clock::time_point& getStartTime() const { return m_startTime; }
+        inline const Clock& getClock() const { return m_clock; }
+
+
         IKLOG_EXPORT static OstreamWrapper DEFAULT_OUTPUT; // The default output for logs when no output is provided
 
+
+        mutable LogMetrics m_metrics; // counters of the Log, also updated by the Logs dropping messages
+
     private:
 
-        inline static std::map<std::string, Log*>& getLogsList()
+        /*!
+         * \brief Logs a message that has passed the level and rate limiting checks, counting it in the metrics
+         * \param level The level of the logging message
+         * \param message The message to log
+         * \param fields The structured fields of the message
+         */
+        inline void logAdmitted(Level level, std::string_view message, std::span<const Field> fields = {}) const
         {
-            static std::map<std::string, Log*> logsList;
-            return logsList;
+            const LogMetrics::LogScope metricsScope(m_metrics, level);
+            doLog(level, message, fields);
         }
 
+        /*!
+         * \brief Tells whether a limiter lets a new message through, writing the summary of the suppressed messages if it is due
+         * \param limiter The limiter to check
+         * \param level The level of the logging message
+         * \return True if the message can be logged
+         */
+        inline bool acquire(RateLimiter& limiter, Level level) const
+        {
+            if(!limiter.tryAcquire())
+            {
+                m_metrics.countSuppressed();
+                return false;
+            }
+
+            const uint64_t suppressedCount = limiter.takeSummary();
+            if(suppressedCount != 0)
+                writeSuppressedSummary(level, suppressedCount);
+
+            return true;
+        }
+
+        /*!
+         * \brief Logs the number of messages suppressed by a limiter
+         * \param level The level of the summary
+         * \param suppressedCount The number of suppressed messages
+         */
+        IKLOG_EXPORT void writeSuppressedSummary(Level level, uint64_t suppressedCount) const;
+
+        /*!
+         * \brief Writes the summaries of the rate limiters of the enabled levels
+         * \param remaining True to write all the suppressed messages not reported yet, false to respect the summary intervals
+         */
+        void writeSummaries(bool remaining) const;
+
+        /*!
+         * \brief Makes the background thread write the summaries of the rate limiters, if there are some
+         */
+        void scheduleSummaries();
+
+        /*!
+         * \brief Stops the background thread from writing the summaries, waiting for them if they are being written
+         */
+        void unscheduleSummaries();
+
 
         const std::string m_name;
-        std::map<Level, Output*> m_outputs;
+        internal::LogSlot* m_registrySlot; // entry of the name of the Log in the registry
+        std::array<std::vector<Output*>, LEVEL_COUNT> m_outputs; // outputs of each level, by level index
+        std::array<RateLimiter*, LEVEL_COUNT> m_rateLimiters; // limiter of each level, by level index, null if unlimited
+        bool m_summariesScheduled; // whether the background thread writes the summaries of the limiters
         int m_levels;
+        Clock m_clock; // gives the timestamps of the messages
         std::chrono::system_clock::time_point m_startTime;
         Formatter m_formatter;
 };
 
 }
 
+/*!
+ * \brief Logs a message in the given level, the arguments are only evaluated if the level is enabled
+ * \param logger The iklog::Log to log to
+ * \param level The level of the logging message
+ * \param ... The message, or a format followed by its arguments
+ */
+#define IKLOG_LOG(logger, level, ...) \
+    do \
+    { \
+        if((logger).isLevelEnabled(level)) \
+            (logger).log(level, __VA_ARGS__); \
+    } while(false)
+
+/*!
+ * \brief Same as IKLOG_LOG, but the statement is removed at compile time if the level is below IKLOG_MIN_LEVEL
+ * \param logger The iklog::Log to log to
+ * \param level The level of the logging message, must be a constant
+ * \param ... The message, or a format followed by its arguments
+ */
+#define IKLOG_LOG_COMPILED(logger, level, ...) \
+    do \
+    { \
+        if constexpr(iklog::isLevelCompiled(level)) \
+            IKLOG_LOG(logger, level, __VA_ARGS__); \
+    } while(false)
+
+/*!
+ * \brief Logs a message in the given level, through a limiter created for this call site the first time it is executed
+ * \param logger The iklog::Log to log to
+ * \param limiter The limiter of the call site, e.g. iklog::RateLimiter::tokenBucket(10, 100) or iklog::RateLimiter::sampling(1000)
+ * \param level The level of the logging message
+ * \param ... The message, or a format followed by its arguments
+ */
+#define IKLOG_LOG_LIMITED(logger, limiter, level, ...) \
+    do \
+    { \
+        static iklog::RateLimiter iklogRateLimiter = limiter; \
+        (logger).logLimited(iklogRateLimiter, level, __VA_ARGS__); \
+    } while(false)
+
+#define IKLOG_INFO(logger, ...)  IKLOG_LOG_COMPILED(logger, iklog::Level::INFO, __VA_ARGS__)    //! IKLOG_LOG in INFO level
+#define IKLOG_DEBUG(logger, ...) IKLOG_LOG_COMPILED(logger, iklog::Level::DEBUG, __VA_ARGS__)   //! IKLOG_LOG in DEBUG level
+#define IKLOG_WARN(logger, ...)  IKLOG_LOG_COMPILED(logger, iklog::Level::WARNING, __VA_ARGS__) //! IKLOG_LOG in WARNING level
+#define IKLOG_ERROR(logger, ...) IKLOG_LOG_COMPILED(logger, iklog::Level::ERROR, __VA_ARGS__)   //! IKLOG_LOG in ERROR level
+
 #endif // IKLOG_LOG_HPP
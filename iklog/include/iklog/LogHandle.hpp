@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_LOG_HANDLE_HPP
+#define IKLOG_LOG_HANDLE_HPP
+
+#include "NullLog.hpp"
+#include "iklog_export.hpp"
+#include <atomic>
+#include <string_view>
+
+namespace iklog
+{
+    namespace internal
+    {
+        /*!
+         * \brief Entry of a name in the registry of the Log instances, holding the Log registered with this name
+         */
+        struct LogSlot
+        {
+            std::atomic<Log*> log = nullptr; // Log registered with the name, nullptr if there is none
+        };
+    }
+
+    /*!
+     * \brief Gives access to the Log having a specific name, with the name resolved only once
+     *
+     * Intended to be kept by code logging often, for example as a static variable, instead of calling Log::getLog.
+     * A handle can be created before its Log: it follows the Log registered with its name, and gives the iklog::NullLog
+     * while there is none. Accessing the Log through a handle only costs an atomic load
+     */
+    class LogHandle
+    {
+        public:
+
+            /*!
+             * \brief Constructor, resolves the name
+             * \param name The name of the Log to access
+             */
+            IKLOG_EXPORT explicit LogHandle(std::string_view name);
+
+            /*!
+             * \brief Gives the Log currently registered with the name of the handle
+             * \return The Log with the name of the handle, or the iklog::NullLog if there is none
+             */
+            inline Log& get() const
+            {
+                Log* const log = m_slot->log.load(std::memory_order_acquire);
+                return log != nullptr ? *log : NullLog::getInstance();
+            }
+
+            inline Log& operator*() const { return get(); }
+            inline Log* operator->() const { return &get(); }
+
+        private:
+
+            internal::LogSlot* m_slot; // entry of the name in the registry
+    };
+}
+
+#endif // IKLOG_LOG_HANDLE_HPP
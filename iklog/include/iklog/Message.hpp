@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, 2020, 2023, InternationalKoder
+    Copyright (C) 2019, 2020, 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -20,9 +20,12 @@
 #ifndef IKLOG_MESSAGE_HPP
 #define IKLOG_MESSAGE_HPP
 
-#include <string>
+#include <string_view>
 #include <chrono>
+#include <span>
+#include "Field.hpp"
 #include "Level.hpp"
+#include "ThreadContext.hpp"
 #include "iklog_export.hpp"
 
 namespace iklog
@@ -30,6 +33,9 @@ namespace iklog
 
 /*!
  * \brief Defines a logging message, only contains data
+ *
+ * The log name, the message text, the fields and the thread context are not copied: a Message only refers to them,
+ * so it must not outlive the strings, fields and context it has been created from
  */
 class Message
 {
@@ -39,22 +45,28 @@ class Message
         using TimePoint = std::chrono::system_clock::time_point;
 
 
-        IKLOG_EXPORT Message(const std::string& logName, Level level, const std::string& message,
-                             const Duration& programDuration, const TimePoint& clockTime);
+        IKLOG_EXPORT Message(std::string_view logName, Level level, std::string_view message,
+                             const Duration& programDuration, const TimePoint& clockTime,
+                             std::span<const Field> fields = {},
+                             const ThreadContext& threadContext = ThreadContext::current());
 
-        inline const std::string& getLogName() const { return m_logName; }
+        inline std::string_view getLogName() const { return m_logName; }
         inline Level getLevel() const { return m_level; }
-        inline const std::string& getMessage() const { return m_message; }
+        inline std::string_view getMessage() const { return m_message; }
         inline const Duration& getProgramDuration() const { return m_programDuration; }
         inline const TimePoint& getClockTime() const { return m_clockTime; }
+        inline std::span<const Field> getFields() const { return m_fields; }
+        inline const ThreadContext& getThreadContext() const { return *m_threadContext; }
 
     private:
 
-        const std::string m_logName;
+        const std::string_view m_logName;
         const Level m_level;
-        const std::string m_message;
+        const std::string_view m_message;
         const Duration  m_programDuration;
         const TimePoint  m_clockTime;
+        const std::span<const Field> m_fields; // structured fields of the message, empty for a plain text message
+        const ThreadContext* const m_threadContext; // context of the thread that logged the message
 };
 
 }
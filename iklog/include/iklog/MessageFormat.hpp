@@ -0,0 +1,116 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_MESSAGE_FORMAT_HPP
+#define IKLOG_MESSAGE_FORMAT_HPP
+
+#include "iklog_export.hpp"
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace iklog
+{
+    namespace internal
+    {
+        template<typename T>
+        inline constexpr bool UNSUPPORTED_ARGUMENT = false; // delays the failure of the static_assert to the instantiation
+
+        template<typename T>
+        inline constexpr bool IS_C_STRING = std::is_same_v<T, const char*> || std::is_same_v<T, char*>; // may be null, unlike other strings
+
+        inline constexpr std::string_view NULL_STRING = "(null)"; // written instead of a null C string
+
+        /*!
+         * \brief Gives a buffer for each thread, where messages built from a format and arguments are rendered
+         * \return The cleared buffer of the calling thread
+         */
+        IKLOG_EXPORT std::string& getMessageBuffer();
+
+        /*!
+         * \brief Appends the text representation of a value to a string, without intermediate allocation
+         *
+         * Supported types are booleans, characters, numbers, enumerations, pointers and anything convertible to a std::string_view.
+         * A null C string is written as NULL_STRING
+         * \param output [out] The string the value is appended to
+         * \param value The value to append
+         */
+        template<typename T>
+        void appendArgument(std::string& output, const T& value)
+        {
+            if constexpr(std::is_same_v<T, bool>)
+                output += value ? "true" : "false";
+            else if constexpr(std::is_same_v<T, char>)
+                output += value;
+            else if constexpr(std::is_arithmetic_v<T>)
+            {
+                char buff[64];
+                const std::to_chars_result result = std::to_chars(buff, buff + sizeof(buff), value);
+                output.append(buff, result.ptr);
+            }
+            else if constexpr(std::is_enum_v<T>)
+                appendArgument(output, static_cast<std::underlying_type_t<T>>(value));
+            else if constexpr(IS_C_STRING<T>)
+                output += value != nullptr ? std::string_view(value) : NULL_STRING;
+            else if constexpr(std::is_convertible_v<const T&, std::string_view>)
+                output += std::string_view(value);
+            else if constexpr(std::is_pointer_v<T>)
+            {
+                char buff[2 + 2 * sizeof(uintptr_t)] = {'0', 'x'};
+                const std::to_chars_result result = std::to_chars(buff + 2, buff + sizeof(buff), reinterpret_cast<uintptr_t>(value), 16);
+                output.append(buff, result.ptr);
+            }
+            else
+                static_assert(UNSUPPORTED_ARGUMENT<T>, "Unsupported type for a log message argument");
+        }
+
+        /*!
+         * \brief Renders a message from a format and arguments
+         *
+         * Each "{}" in the format is replaced by the next argument. Arguments without a matching "{}" are ignored
+         * \param output [out] The string the message is appended to
+         * \param format The format of the message
+         * \param arguments The values replacing the "{}" of the format
+         */
+        template<typename... ARGS>
+        void formatMessage(std::string& output, std::string_view format, const ARGS&... arguments)
+        {
+            std::string_view::size_type position = 0;
+
+            const auto appendNext = [&output, &format, &position](const auto& argument)
+            {
+                const std::string_view::size_type placeholder = format.find("{}", position);
+                if(placeholder == std::string_view::npos)
+                    return;
+
+                output.append(format, position, placeholder - position);
+                appendArgument(output, argument);
+                position = placeholder + 2;
+            };
+
+            (appendNext(arguments), ...);
+
+            output.append(format, position);
+        }
+    }
+}
+
+#endif // IKLOG_MESSAGE_FORMAT_HPP
@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2020, InternationalKoder
+    Copyright (C) 2020, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -44,10 +44,12 @@ namespace iklog
              */
             IKLOG_EXPORT static inline NullLog& getInstance() { return m_nullLog; }
 
+        protected:
+
             /*!
              * \brief Logs nothing
              */
-            IKLOG_EXPORT inline virtual void log(Level, const std::string&) const override {}
+            IKLOG_EXPORT inline virtual void doLog(Level, std::string_view, std::span<const Field>) const override {}
 
         private:
 
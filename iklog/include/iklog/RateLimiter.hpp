@@ -0,0 +1,223 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_RATE_LIMITER_HPP
+#define IKLOG_RATE_LIMITER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+namespace iklog
+{
+
+/*!
+ * \brief Limits the number of messages logged, to keep logging cheap during message storms
+ *
+ * Two kinds of limiters exist:
+ * - a token bucket, letting a burst of messages through then a steady rate of messages per second
+ * - a sampling, letting one message out of N through
+ *
+ * A limiter is set to some levels of an iklog::Log with Log::setRateLimiter, or used for a single call site with
+ * the IKLOG_LOG_LIMITED macro. Checking a message takes about one atomic operation and is done before any formatting.
+ * The number of suppressed messages is reported by a summary line, at most once per summary interval, written
+ * before the next message that is let through. The limiters set to a Log are also checked by a background thread
+ * at each summary interval, and when the Log is destroyed, so the end of a storm is reported even if no message is let
+ * through afterwards. Limiters of call sites are only reported with their next message let through
+ */
+class RateLimiter
+{
+    public:
+
+        static constexpr std::chrono::milliseconds DEFAULT_SUMMARY_INTERVAL{1000}; //! default minimum time between two summary lines
+        static constexpr int64_t MAX_INTERVAL = 365LL * 24 * 3600 * 1000000000; //! longest time between two messages of a token bucket, in nanoseconds (one year)
+
+
+        /*!
+         * \brief Creates a token bucket limiter
+         *
+         * The rate is clamped: a rate lower than one message per MAX_INTERVAL, including a rate of 0, lets almost only
+         * the burst through, and a rate higher than one message per nanosecond lets all the messages through
+         * \param messagesPerSecond The number of messages let through per second, once the burst is used
+         * \param burst The number of messages that can be let through at once
+         * \param summaryInterval The minimum time between two summary lines
+         * \return The limiter
+         */
+        static inline RateLimiter tokenBucket(double messagesPerSecond, unsigned int burst,
+                                              std::chrono::milliseconds summaryInterval = DEFAULT_SUMMARY_INTERVAL)
+        {
+            // written so that NaN also gives the longest interval
+            const double interval = messagesPerSecond > 1e9 / MAX_INTERVAL ? std::max(1e9 / messagesPerSecond, 1.) : MAX_INTERVAL;
+
+            // the tolerance is bounded so that adding it to the current time cannot overflow
+            const double tolerance = std::min(interval * (std::max(burst, 1u) - 1), MAX_TOLERANCE);
+
+            return RateLimiter(static_cast<int64_t>(interval), static_cast<int64_t>(tolerance), 0, summaryInterval);
+        }
+
+        /*!
+         * \brief Creates a sampling limiter, letting the first message through then one message out of a given number
+         * \param rate The number of messages for each message let through
+         * \param summaryInterval The minimum time between two summary lines
+         * \return The limiter
+         */
+        static inline RateLimiter sampling(unsigned int rate, std::chrono::milliseconds summaryInterval = DEFAULT_SUMMARY_INTERVAL)
+        {
+            return RateLimiter(0, 0, std::max(rate, 1u), summaryInterval);
+        }
+
+
+        RateLimiter(const RateLimiter&) = delete;
+        RateLimiter& operator=(const RateLimiter&) = delete;
+
+
+        /*!
+         * \brief Tells whether a new message can be logged, counting it as suppressed otherwise
+         * \return True if the message can be logged
+         */
+        inline bool tryAcquire()
+        {
+            if(m_samplingRate != 0)
+                return m_messageCount.fetch_add(1, std::memory_order_relaxed) % m_samplingRate == 0;
+
+            // generic cell rate algorithm: a single theoretical arrival time holds the state of the bucket
+            const int64_t now = getNow();
+            int64_t arrival = m_theoreticalArrival.load(std::memory_order_relaxed);
+            int64_t start;
+            do
+            {
+                start = std::max(arrival, now);
+                if(start - now > m_tolerance)
+                {
+                    m_suppressedCount.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            } while(!m_theoreticalArrival.compare_exchange_weak(arrival, start + m_interval, std::memory_order_relaxed));
+
+            return true;
+        }
+
+        /*!
+         * \brief Gives the number of messages suppressed since the last summary, if a summary has to be written now
+         *
+         * Only one of the threads calling this method at the same time gets the count
+         * \return The number of messages to report in a summary line, 0 if there is no summary to write
+         */
+        inline uint64_t takeSummary()
+        {
+            // most calls have nothing to report, they do not read the clock
+            const uint64_t suppressed = getSuppressedCount();
+            if(suppressed == m_reportedCount.load(std::memory_order_relaxed))
+                return 0;
+
+            const int64_t now = getNow();
+            int64_t nextSummary = m_nextSummary.load(std::memory_order_relaxed);
+            if(now < nextSummary || !m_nextSummary.compare_exchange_strong(nextSummary, now + m_summaryInterval, std::memory_order_relaxed))
+                return 0;
+
+            return takeUnreported(suppressed);
+        }
+
+        /*!
+         * \brief Gives the number of messages suppressed since the last summary, whatever the summary interval
+         *
+         * Used to report the last suppressed messages when the limiter stops being used
+         * \return The number of messages to report in a summary line, 0 if there is no summary to write
+         */
+        inline uint64_t takeRemainingSummary()
+        {
+            return takeUnreported(getSuppressedCount());
+        }
+
+        /*!
+         * \brief Gives the minimum time between two summary lines
+         * \return The summary interval
+         */
+        inline std::chrono::milliseconds getSummaryInterval() const
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::nanoseconds(m_summaryInterval));
+        }
+
+        /*!
+         * \brief Gives the number of messages suppressed since the creation of the limiter
+         * \return The number of suppressed messages
+         */
+        inline uint64_t getSuppressedCount() const
+        {
+            if(m_samplingRate == 0)
+                return m_suppressedCount.load(std::memory_order_relaxed);
+
+            const uint64_t count = m_messageCount.load(std::memory_order_relaxed);
+            return count - (count + m_samplingRate - 1) / m_samplingRate;
+        }
+
+    private:
+
+        static constexpr double MAX_TOLERANCE = static_cast<double>(std::numeric_limits<int64_t>::max() / 4);
+
+
+        RateLimiter(int64_t interval, int64_t tolerance, unsigned int samplingRate, std::chrono::milliseconds summaryInterval) :
+            m_interval(interval),
+            m_tolerance(tolerance),
+            m_samplingRate(samplingRate),
+            m_summaryInterval(std::chrono::duration_cast<std::chrono::nanoseconds>(summaryInterval).count()),
+            m_theoreticalArrival(0),
+            m_messageCount(0),
+            m_suppressedCount(0),
+            m_reportedCount(0),
+            m_nextSummary(0)
+        {}
+
+        /*!
+         * \brief Marks the suppressed messages as reported
+         * \param suppressed The number of messages suppressed since the creation of the limiter
+         * \return The number of messages that were not reported yet, 0 if another thread has reported them
+         */
+        inline uint64_t takeUnreported(uint64_t suppressed)
+        {
+            uint64_t reported = m_reportedCount.load(std::memory_order_relaxed);
+            while(reported < suppressed && !m_reportedCount.compare_exchange_weak(reported, suppressed, std::memory_order_relaxed))
+            {}
+
+            return reported < suppressed ? suppressed - reported : 0;
+        }
+
+        static inline int64_t getNow()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+
+        const int64_t m_interval; // time between two messages once the burst is used, in nanoseconds
+        const int64_t m_tolerance; // how far the theoretical arrival time can be ahead of the current time, in nanoseconds
+        const unsigned int m_samplingRate; // number of messages for each message let through, 0 for a token bucket
+        const int64_t m_summaryInterval; // minimum time between two summaries, in nanoseconds
+
+        std::atomic<int64_t> m_theoreticalArrival; // time at which the bucket will be full again, in nanoseconds
+        std::atomic<uint64_t> m_messageCount; // number of messages checked by a sampling limiter
+        std::atomic<uint64_t> m_suppressedCount; // number of messages suppressed by a token bucket
+        std::atomic<uint64_t> m_reportedCount; // number of suppressed messages already reported by a summary
+        std::atomic<int64_t> m_nextSummary; // earliest time of the next summary, in nanoseconds
+};
+
+}
+
+#endif // IKLOG_RATE_LIMITER_HPP
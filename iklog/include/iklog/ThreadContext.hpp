@@ -0,0 +1,164 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_THREAD_CONTEXT_HPP
+#define IKLOG_THREAD_CONTEXT_HPP
+
+#include "iklog_export.hpp"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace iklog
+{
+
+/*!
+ * \brief Identity and mapped diagnostic context (MDC) of a thread, written by the iklog::Formatter
+ *
+ * Each thread has its own context: an identifier, a name and key-value entries such as a request identifier.
+ * The identifier is a number: the thread id of the system on Linux, or a number given in the order the threads
+ * first use their context on other systems.
+ * The static functions change the context of the calling thread. The strings written by the Formatter are rendered
+ * when the context changes, not for each message, and a version number tells the copies of a context apart
+ */
+class ThreadContext
+{
+    public:
+
+        /*!
+         * \brief Puts an entry in the context of the calling thread for the lifetime of the Scope
+         *
+         * The previous value of the key, if any, is put back when the Scope is destroyed
+         */
+        class Scope
+        {
+            public:
+
+                /*!
+                 * \brief Constructor, puts the entry in the context
+                 * \param key The key of the entry
+                 * \param value The value of the entry
+                 */
+                IKLOG_EXPORT Scope(std::string_view key, std::string_view value);
+
+                /*!
+                 * \brief Destructor, restores the previous value of the key
+                 */
+                IKLOG_EXPORT ~Scope();
+
+                Scope(const Scope&) = delete;
+                Scope& operator=(const Scope&) = delete;
+
+            private:
+
+                std::string m_key;
+                std::optional<std::string> m_previousValue;
+        };
+
+
+        /*!
+         * \brief Constructor of an empty context, without identifier nor entries
+         */
+        IKLOG_EXPORT ThreadContext();
+
+
+        /*!
+         * \brief Gives the context of the calling thread
+         * \return The context of the calling thread
+         */
+        IKLOG_EXPORT static const ThreadContext& current();
+
+        /*!
+         * \brief Names the calling thread in the logs
+         *
+         * By default, a thread has the name given by the operating system when it first uses its context (only on Linux).
+         * The system name is not read again, so a thread renamed afterwards through the system keeps its previous name
+         * in the logs: this function has to be used instead
+         * \param name The name of the thread
+         */
+        IKLOG_EXPORT static void setThreadName(std::string_view name);
+
+        /*!
+         * \brief Puts an entry in the context of the calling thread, replacing the value of the key if it is already present
+         * \param key The key of the entry
+         * \param value The value of the entry
+         */
+        IKLOG_EXPORT static void put(std::string_view key, std::string_view value);
+
+        /*!
+         * \brief Removes an entry from the context of the calling thread
+         * \param key The key of the entry
+         */
+        IKLOG_EXPORT static void remove(std::string_view key);
+
+        /*!
+         * \brief Removes all the entries from the context of the calling thread, keeping its name
+         */
+        IKLOG_EXPORT static void clear();
+
+
+        inline std::string_view getThreadId() const { return m_threadId; }
+        inline std::string_view getThreadName() const { return m_threadName; }
+        inline const std::vector<std::pair<std::string, std::string>>& getEntries() const { return m_entries; }
+
+        /*!
+         * \brief Gives the entries rendered as logfmt pairs separated by spaces
+         * \return The rendered entries
+         */
+        inline std::string_view getLogfmtEntries() const { return m_logfmtEntries; }
+
+        /*!
+         * \brief Gives the entries rendered as JSON members, each one preceded by a comma
+         * \return The rendered entries
+         */
+        inline std::string_view getJsonEntries() const { return m_jsonEntries; }
+
+        /*!
+         * \brief Gives the version of the context, unique among all the threads and changed at each modification
+         * \return The version of the context, 0 for a context created empty rather than given by current()
+         */
+        inline uint64_t getVersion() const { return m_version; }
+
+    private:
+
+        /*!
+         * \brief Gives the context of the calling thread, that can be modified
+         * \return The context of the calling thread
+         */
+        static ThreadContext& getCurrent();
+
+        /*!
+         * \brief Renders the entries and gives a new version to the context, after a modification
+         */
+        void update();
+
+        std::string m_threadId;
+        std::string m_threadName;
+        std::vector<std::pair<std::string, std::string>> m_entries; // entries in the order they were put
+        std::string m_logfmtEntries;
+        std::string m_jsonEntries;
+        uint64_t m_version;
+};
+
+}
+
+#endif // IKLOG_THREAD_CONTEXT_HPP
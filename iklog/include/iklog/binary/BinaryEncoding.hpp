@@ -0,0 +1,206 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_BINARY_ENCODING_HPP
+#define IKLOG_BINARY_ENCODING_HPP
+
+#include "../MessageFormat.hpp"
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace iklog
+{
+    namespace internal
+    {
+        /*!
+         * \brief Layout of the binary log files
+         *
+         * A file starts with a header: the magic bytes, the format version, the log name (varint length + bytes)
+         * and the start time of the log (varint of nanoseconds since epoch). It is followed by records, each starting with a tag:
+         * - FORMAT_RECORD defines a format string: varint identifier, varint length + bytes
+         * - EVENT_RECORD is a logged message: varint format identifier, varint level, zigzag varint of the nanoseconds elapsed
+         *   since the previous event (or since the start time), one byte for the number of arguments, then the arguments
+         *
+         * Each argument is a BinaryType followed by its value. Integers are stored as varints, signed ones with zigzag encoding.
+         * Floating point values are stored as raw bytes, in the byte order of the machine that wrote the file
+         */
+        namespace binary
+        {
+            static constexpr char MAGIC[4] = {'I', 'K', 'L', 'B'};
+            static constexpr uint8_t VERSION = 1;
+
+            static constexpr uint8_t FORMAT_RECORD = 'F';
+            static constexpr uint8_t EVENT_RECORD = 'E';
+
+            static constexpr uint32_t RAW_MESSAGE_FORMAT = 0; // predefined format for messages logged as plain text
+            static constexpr std::string_view RAW_MESSAGE_FORMAT_STRING = "{}";
+
+            static constexpr size_t MAX_ARGUMENTS = std::numeric_limits<uint8_t>::max();
+
+            static constexpr uint64_t MAX_FORMAT_ID = 1 << 20; // far more than the formats of a program, rejects corrupted identifiers
+        }
+
+        /*!
+         * \brief Type of an argument stored in a binary log file
+         */
+        enum class BinaryType : uint8_t
+        {
+            BOOL_FALSE,
+            BOOL_TRUE,
+            CHAR,
+            SIGNED,
+            UNSIGNED,
+            FLOAT,
+            DOUBLE,
+            STRING,
+            POINTER
+        };
+
+        template<typename T>
+        inline constexpr bool UNSUPPORTED_BINARY_ARGUMENT = false; // delays the failure of the static_assert to the instantiation
+
+
+        /*!
+         * \brief Appends an unsigned integer as a variable length integer (7 bits per byte)
+         * \param output [out] The buffer the value is appended to
+         * \param value The value to append
+         */
+        inline void appendVarint(std::string& output, uint64_t value)
+        {
+            while(value >= 0x80)
+            {
+                output += static_cast<char>((value & 0x7F) | 0x80);
+                value >>= 7;
+            }
+
+            output += static_cast<char>(value);
+        }
+
+        /*!
+         * \brief Converts a signed integer so that small absolute values give small varints
+         * \param value The value to convert
+         * \return The zigzag encoded value
+         */
+        inline constexpr uint64_t zigzagEncode(int64_t value)
+        {
+            return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        }
+
+        /*!
+         * \brief Reverts the zigzag encoding of a signed integer
+         * \param value The encoded value
+         * \return The original signed value
+         */
+        inline constexpr int64_t zigzagDecode(uint64_t value)
+        {
+            return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+        }
+
+        /*!
+         * \brief Appends the raw bytes of a value
+         * \param output [out] The buffer the value is appended to
+         * \param value The value to append
+         */
+        template<typename T>
+        inline void appendRaw(std::string& output, const T& value)
+        {
+            char bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            output.append(bytes, sizeof(T));
+        }
+
+        /*!
+         * \brief Appends the binary representation of an argument: its type followed by its value
+         *
+         * Supported types are the same as for text messages (see iklog::internal::appendArgument), a null C string is
+         * stored as the NULL_STRING string
+         * \param output [out] The buffer the argument is appended to
+         * \param value The value to append
+         */
+        template<typename T>
+        void appendBinaryArgument(std::string& output, const T& value)
+        {
+            if constexpr(std::is_same_v<T, bool>)
+                output += static_cast<char>(value ? BinaryType::BOOL_TRUE : BinaryType::BOOL_FALSE);
+            else if constexpr(std::is_same_v<T, char>)
+            {
+                output += static_cast<char>(BinaryType::CHAR);
+                output += value;
+            }
+            else if constexpr(std::is_integral_v<T> && std::is_signed_v<T>)
+            {
+                output += static_cast<char>(BinaryType::SIGNED);
+                appendVarint(output, zigzagEncode(value));
+            }
+            else if constexpr(std::is_integral_v<T>)
+            {
+                output += static_cast<char>(BinaryType::UNSIGNED);
+                appendVarint(output, value);
+            }
+            else if constexpr(std::is_same_v<T, float>)
+            {
+                output += static_cast<char>(BinaryType::FLOAT);
+                appendRaw(output, value);
+            }
+            else if constexpr(std::is_floating_point_v<T>)
+            {
+                output += static_cast<char>(BinaryType::DOUBLE);
+                appendRaw(output, static_cast<double>(value));
+            }
+            else if constexpr(std::is_enum_v<T>)
+                appendBinaryArgument(output, static_cast<std::underlying_type_t<T>>(value));
+            else if constexpr(IS_C_STRING<T>)
+                appendBinaryArgument(output, value != nullptr ? std::string_view(value) : NULL_STRING);
+            else if constexpr(std::is_convertible_v<const T&, std::string_view>)
+            {
+                const std::string_view text(value);
+                output += static_cast<char>(BinaryType::STRING);
+                appendVarint(output, text.size());
+                output += text;
+            }
+            else if constexpr(std::is_pointer_v<T>)
+            {
+                output += static_cast<char>(BinaryType::POINTER);
+                appendVarint(output, reinterpret_cast<uintptr_t>(value));
+            }
+            else
+                static_assert(UNSUPPORTED_BINARY_ARGUMENT<T>, "Unsupported type for a binary log message argument");
+        }
+
+        /*!
+         * \brief Appends the number of arguments followed by the binary representation of each of them
+         * \param output [out] The buffer the arguments are appended to
+         * \param arguments The arguments to append
+         */
+        template<typename... ARGS>
+        void appendBinaryArguments(std::string& output, const ARGS&... arguments)
+        {
+            static_assert(sizeof...(ARGS) <= binary::MAX_ARGUMENTS, "Too many arguments for a binary log message");
+
+            output += static_cast<char>(sizeof...(ARGS));
+            (appendBinaryArgument(output, arguments), ...);
+        }
+    }
+}
+
+#endif // IKLOG_BINARY_ENCODING_HPP
@@ -0,0 +1,163 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_BINARY_LOG_HPP
+#define IKLOG_BINARY_LOG_HPP
+
+#include "../Log.hpp"
+#include "../iklog_export.hpp"
+#include "BinaryEncoding.hpp"
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace iklog
+{
+
+/*!
+ * \brief A Log that writes its messages to a compact binary file, without formatting them
+ *
+ * Each message is stored as the identifier of its format, its timestamp and the raw bytes of its arguments.
+ * The formats are written once in the file, the first time they are used.
+ * The file is turned into text later with iklog::BinaryLogReader, for example with the iklog-decode tool.
+ *
+ * Formats are registered once per call site, usually with the IKLOG_BINARY_LOG macro:
+ * \code
+ * IKLOG_BINARY_LOG(binaryLog, iklog::Level::INFO, "Received {} bytes from {}", size, address);
+ * \endcode
+ * Messages logged with the other methods of iklog::Log are stored as plain text
+ */
+class BinaryLog : public Log
+{
+    public:
+
+        /*!
+         * \brief Identifier of a registered format
+         */
+        struct FormatId
+        {
+            uint32_t value;
+        };
+
+
+        /*!
+         * \brief Constructor, throws std::runtime_error if the file cannot be opened
+         * \param name The name of the Log
+         * \param levels List of the enabled logging levels (flags)
+         * \param filename The binary file to write to, it is truncated if it already exists
+         */
+        IKLOG_EXPORT BinaryLog(const std::string& name, int levels, const std::string& filename);
+
+        IKLOG_EXPORT virtual ~BinaryLog();
+
+
+        /*!
+         * \brief Registers a format, so it can be used to log messages in any BinaryLog
+         * \param format The format: each "{}" is replaced by the next argument when the message is decoded
+         * \return The identifier of the format
+         */
+        IKLOG_EXPORT static FormatId registerFormat(std::string_view format);
+
+
+        using Log::log;
+
+        /*!
+         * \brief Logs a message from a registered format and arguments in the given level
+         * \param level The level of the logging message
+         * \param format The identifier of the format, given by registerFormat
+         * \param arguments The values replacing the "{}" of the format
+         */
+        template<typename... ARGS>
+        void log(Level level, FormatId format, const ARGS&... arguments) const
+        {
+            if(!isLevelEnabled(level) || !isAllowedByRateLimiter(level))
+                return;
+
+            const LogMetrics::LogScope metricsScope(m_metrics, level);
+            std::string& buffer = internal::getMessageBuffer();
+            internal::appendBinaryArguments(buffer, arguments...);
+            writeEvent(level, format, buffer);
+        }
+
+    protected:
+
+        /*!
+         * \brief Logs a message as plain text in the given level, its structured fields being appended as logfmt pairs
+         * \param level The level of the logging message
+         * \param message The message to log
+         * \param fields The structured fields of the message, may be empty
+         */
+        IKLOG_EXPORT virtual void doLog(Level level, std::string_view message, std::span<const Field> fields) const override;
+
+    private:
+
+        /*!
+         * \brief Writes an event record to the file, preceded by the definition of its format if it is not in the file yet
+         * \param level The level of the logging message
+         * \param format The identifier of the format of the message
+         * \param encodedArguments The number of arguments followed by the arguments, as given by appendBinaryArguments
+         */
+        IKLOG_EXPORT void writeEvent(Level level, FormatId format, std::string_view encodedArguments) const;
+
+
+        mutable std::mutex m_mutex; // protects the file and the state of the encoding
+        mutable std::ofstream m_file;
+        mutable std::string m_record; // buffer for the record being written
+        mutable std::vector<bool> m_writtenFormats; // formats whose definition has been written in the file
+        mutable Message::TimePoint m_previousTime; // time of the previous event, as event times are stored relatively to it
+};
+
+}
+
+/*!
+ * \brief Logs a message in a iklog::BinaryLog, registering its format the first time this line is executed
+ *
+ * Like IKLOG_LOG, the arguments are not evaluated if the level is not enabled
+ * \param logger The iklog::BinaryLog to log to
+ * \param level The level of the logging message
+ * \param format The format of the message, a string literal
+ * \param ... The values replacing the "{}" of the format
+ */
+#define IKLOG_BINARY_LOG(logger, level, format, ...) \
+    do \
+    { \
+        if((logger).isLevelEnabled(level)) \
+        { \
+            static const iklog::BinaryLog::FormatId iklogFormatId = iklog::BinaryLog::registerFormat(format); \
+            (logger).log(level, iklogFormatId __VA_OPT__(,) __VA_ARGS__); \
+        } \
+    } while(false)
+
+/*!
+ * \brief Same as IKLOG_BINARY_LOG, but the statement is removed at compile time if the level is below IKLOG_MIN_LEVEL
+ * \param logger The iklog::BinaryLog to log to
+ * \param level The level of the logging message, must be a constant
+ * \param format The format of the message, a string literal
+ * \param ... The values replacing the "{}" of the format
+ */
+#define IKLOG_BINARY_LOG_COMPILED(logger, level, format, ...) \
+    do \
+    { \
+        if constexpr(iklog::isLevelCompiled(level)) \
+            IKLOG_BINARY_LOG(logger, level, format __VA_OPT__(,) __VA_ARGS__); \
+    } while(false)
+
+#endif // IKLOG_BINARY_LOG_HPP
@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_BINARY_LOG_READER_HPP
+#define IKLOG_BINARY_LOG_READER_HPP
+
+#include "../Formatter.hpp"
+#include "../iklog_export.hpp"
+#include <ikgen/Result.hpp>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace iklog
+{
+
+/*!
+ * \brief Reads a file written by a iklog::BinaryLog and turns it into text
+ */
+class BinaryLogReader
+{
+    public:
+
+        /*!
+         * \brief Creates a new instance of BinaryLogReader. Same as constructor but returns a Result
+         * \param filename The binary log file to read
+         * \return Either the newly created BinaryLogReader in case of success, or an error message otherwise
+         */
+        IKLOG_EXPORT static ikgen::Result<BinaryLogReader, std::string> create(const std::string& filename);
+
+        /*!
+         * \brief Constructor, throws std::runtime_error if the file cannot be opened or is not a binary log file
+         * \param filename The binary log file to read
+         */
+        IKLOG_EXPORT BinaryLogReader(const std::string& filename);
+
+
+        /*!
+         * \brief Formats all the messages of the file and writes them, one per line
+         * \param formatter The formatter to apply to the messages
+         * \param output The stream to write the formatted messages to
+         * \return Either the number of decoded messages in case of success, or an error message otherwise
+         */
+        IKLOG_EXPORT ikgen::Result<size_t, std::string> decode(const Formatter& formatter, std::ostream& output);
+
+
+        /*!
+         * \brief Gives the name of the Log that wrote the file
+         * \return The name of the Log
+         */
+        inline const std::string& getLogName() const { return m_logName; }
+
+    private:
+
+        /*!
+         * \brief Reads a variable length integer from the file
+         * \param value [out] The read value
+         * \return True in case of success, false if the end of the file has been reached
+         */
+        bool readVarint(uint64_t& value);
+
+        /*!
+         * \brief Reads a string preceded by its length from the file
+         * \param value [out] The read string
+         * \return True in case of success, false if the end of the file has been reached or the length goes beyond it
+         */
+        bool readString(std::string& value);
+
+        /*!
+         * \brief Reads the arguments of an event and renders the message from them
+         * \param format The format of the message
+         * \param message [out] The rendered message
+         * \return Nothing in case of success, or an error message otherwise
+         */
+        ikgen::Result<ikgen::EmptyResult, std::string> readMessage(const std::string& format, std::string& message);
+
+
+        std::ifstream m_file;
+        uint64_t m_fileSize; // size of the file, that no string read from it can exceed
+        std::string m_logName;
+        Message::TimePoint m_startTime;
+        std::vector<std::string> m_formats; // formats defined in the file, indexed by their identifier
+};
+
+}
+
+#endif // IKLOG_BINARY_LOG_READER_HPP
@@ -0,0 +1,94 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_LZ_COMPRESSION_HPP
+#define IKLOG_LZ_COMPRESSION_HPP
+
+#include "../iklog_export.hpp"
+#include <ikgen/Result.hpp>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace iklog
+{
+    /*!
+     * \brief Compression of log files with a LZ77 codec, without any external dependency
+     *
+     * The compressed data starts with the magic bytes "IKLZ" and a version byte, followed by independent blocks.
+     * Each block starts with the varint of its uncompressed size and the varint of its compressed size, a compressed size
+     * of 0 meaning the block is stored uncompressed. A block with an uncompressed size of 0 ends the data.
+     * A compressed block is a sequence of literals and matches, encoded like LZ4 blocks: a token giving the literals length
+     * and the match length, the literals, the 2 bytes offset of the match in the previous 64 KiB, the remaining match length
+     */
+    namespace lz
+    {
+        static constexpr const char* FILE_EXTENSION = ".lz"; //! extension added to the name of the compressed files
+
+        /*!
+         * \brief Compresses data in memory
+         * \param data The data to compress
+         * \return The compressed data
+         */
+        IKLOG_EXPORT std::string compress(std::string_view data);
+
+        /*!
+         * \brief Decompresses data in memory
+         * \param data The compressed data
+         * \return Either the decompressed data in case of success, or an error message if the data is not valid
+         */
+        IKLOG_EXPORT ikgen::Result<std::string, std::string> decompress(std::string_view data);
+
+        /*!
+         * \brief Compresses all the data of a stream
+         * \param input The stream to read the data from
+         * \param output The stream to write the compressed data to
+         * \return Either the size of the compressed data in case of success, or an error message otherwise
+         */
+        IKLOG_EXPORT ikgen::Result<uintmax_t, std::string> compress(std::istream& input, std::ostream& output);
+
+        /*!
+         * \brief Decompresses all the data of a stream
+         * \param input The stream to read the compressed data from
+         * \param output The stream to write the decompressed data to
+         * \return Either the size of the decompressed data in case of success, or an error message otherwise
+         */
+        IKLOG_EXPORT ikgen::Result<uintmax_t, std::string> decompress(std::istream& input, std::ostream& output);
+
+        /*!
+         * \brief Compresses a file
+         * \param inputFilename The file to compress
+         * \param outputFilename The compressed file to create
+         * \return Either the size of the compressed file in case of success, or an error message otherwise
+         */
+        IKLOG_EXPORT ikgen::Result<uintmax_t, std::string> compressFile(const std::string& inputFilename, const std::string& outputFilename);
+
+        /*!
+         * \brief Decompresses a file
+         * \param inputFilename The compressed file
+         * \param outputFilename The decompressed file to create
+         * \return Either the size of the decompressed file in case of success, or an error message otherwise
+         */
+        IKLOG_EXPORT ikgen::Result<uintmax_t, std::string> decompressFile(const std::string& inputFilename, const std::string& outputFilename);
+    }
+}
+
+#endif // IKLOG_LZ_COMPRESSION_HPP
@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, InternationalKoder
+    Copyright (C) 2019, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -90,10 +90,10 @@ namespace iklog
 
     inline namespace literals
     {
-        Bytes     operator""_b(unsigned long long value)  { return Bytes(value); }     // allows to write bytes like 12_b
-        KiloBytes operator""_kb(unsigned long long value) { return KiloBytes(value); } // allows to write kilobytes like 34_kb
-        MegaBytes operator""_mb(unsigned long long value) { return MegaBytes(value); } // allows to write megabytes like 56_mb
-        GigaBytes operator""_gb(unsigned long long value) { return GigaBytes(value); } // allows to write gigabytes like 78_gb
+        inline Bytes     operator""_b(unsigned long long value)  { return Bytes(value); }     // allows to write bytes like 12_b
+        inline KiloBytes operator""_kb(unsigned long long value) { return KiloBytes(value); } // allows to write kilobytes like 34_kb
+        inline MegaBytes operator""_mb(unsigned long long value) { return MegaBytes(value); } // allows to write megabytes like 56_mb
+        inline GigaBytes operator""_gb(unsigned long long value) { return GigaBytes(value); } // allows to write gigabytes like 78_gb
     }
 }
 
@@ -0,0 +1,116 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_ROLLING_FILE_NAMES_HPP
+#define IKLOG_ROLLING_FILE_NAMES_HPP
+
+#include "../iklog_export.hpp"
+#include <string>
+
+namespace iklog
+{
+    namespace internal
+    {
+        /*!
+         * \brief Names of the files of a rolling system, and renaming of these files when rolling
+         *
+         * The files are named after a base name followed by a separator and an index: "myfile.log.0", "myfile.log.1", etc.
+         * The file with index 0 is the one being written.
+         * The next file to write is prepared in advance under a name with "next" instead of the index, and is renamed
+         * when the files are rolled.
+         * Rolled files may be compressed, their name is then followed by the extension of the compressed files
+         */
+        class RollingFileNames
+        {
+            public:
+
+                static constexpr const char* TEMPORARY_SUFFIX = ".tmp"; //! extension added to a compressed file while it is written
+
+                /*!
+                 * \brief Constructor
+                 * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+                 * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+                 */
+                IKLOG_EXPORT RollingFileNames(const std::string& baseFilename, unsigned int maxRollingFiles);
+
+                /*!
+                 * \brief Gives the name of the file being written
+                 * \return The name of the file with index 0
+                 */
+                inline const std::string& getFirst() const { return m_firstRollingFileName; }
+
+                /*!
+                 * \brief Gives the name of the file prepared in advance to become the next file with index 0
+                 * \return The name of the next file
+                 */
+                inline const std::string& getNext() const { return m_nextRollingFileName; }
+
+                /*!
+                 * \brief Gives the name of the file with the given index
+                 * \param index The index of the file in the rolling system
+                 * \return The name of the file
+                 */
+                inline std::string getName(unsigned int index) const { return m_baseFilenameSep + std::to_string(index); }
+
+                /*!
+                 * \brief Removes the last file and shifts the index of the other ones, compressed or not
+                 *
+                 * File number 3 becomes file number 4, file number 2 becomes file number 3, etc.
+                 * After this call, there is no file with index 0 anymore. The file being written must be closed before
+                 */
+                IKLOG_EXPORT void shift() const;
+
+                /*!
+                 * \brief Shifts the files, then renames the next file so that it becomes the file with index 0
+                 */
+                IKLOG_EXPORT void promoteNext() const;
+
+                /*!
+                 * \brief Compresses a rolled file, if it exists and is not compressed yet
+                 *
+                 * The file is compressed to a temporary file, which replaces the original file once complete
+                 * \param index The index of the file in the rolling system
+                 */
+                IKLOG_EXPORT void compress(unsigned int index) const;
+
+                /*!
+                 * \brief Handles the files left by a previous run that did not finish its rolling
+                 *
+                 * If the next file contains data, it is the most recent one so it is promoted, otherwise it is removed.
+                 * A file starting with a null byte is considered empty, as it may have been preallocated
+                 * Incomplete compressed files are removed
+                 */
+                IKLOG_EXPORT void recover() const;
+
+            private:
+
+                static constexpr char SEPARATOR = '.'; // separator that will go between the file name and the rolling index
+                static constexpr const char* NEXT_SUFFIX = "next"; // suffix of the next file, in place of the rolling index
+
+
+                const unsigned int m_maxRoll; // index of the last file in the rolling system
+                const std::string m_baseFilenameSep; // base file name + the separator character
+                const std::string m_firstRollingFileName; // actual file name of the first file (the one we write to)
+                const std::string m_lastRollingFileName; // actual file name of the last file (the next one to be removed)
+                const std::string m_nextRollingFileName; // actual file name of the file prepared to be the next first file
+        };
+    }
+}
+
+#endif // IKLOG_ROLLING_FILE_NAMES_HPP
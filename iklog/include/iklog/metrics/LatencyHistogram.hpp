@@ -0,0 +1,153 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_LATENCY_HISTOGRAM_HPP
+#define IKLOG_LATENCY_HISTOGRAM_HPP
+
+#include "../iklog_export.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace iklog
+{
+
+/*!
+ * \brief Histogram of durations in nanoseconds, recorded concurrently with relaxed atomic operations
+ *
+ * The buckets are log-linear: each power of two is divided in SUB_BUCKET_COUNT buckets, so the relative error on
+ * a recorded value is at most 1 / SUB_BUCKET_COUNT. Values of MAX_VALUE_BITS bits or more are counted in the last bucket.
+ * The values are read through a snapshot, which can be taken while values are being recorded
+ */
+class LatencyHistogram
+{
+    public:
+
+        static constexpr unsigned int SUB_BUCKET_BITS = 3;
+        static constexpr size_t SUB_BUCKET_COUNT = size_t(1) << SUB_BUCKET_BITS; //! number of buckets for each power of two
+        static constexpr unsigned int MAX_VALUE_BITS = 40; //! bits of the largest value with its own bucket, about 18 minutes
+        static constexpr size_t BUCKET_COUNT = SUB_BUCKET_COUNT * (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1);
+
+
+        /*!
+         * \brief Values of a histogram at a given time
+         */
+        class Snapshot
+        {
+            public:
+
+                IKLOG_EXPORT Snapshot();
+
+                /*!
+                 * \brief Gives a percentile of the recorded values
+                 * \param percentile The percentile, from 0 to 100
+                 * \return The upper bound of the bucket containing the percentile in nanoseconds, 0 if there is no value
+                 */
+                IKLOG_EXPORT uint64_t getPercentile(double percentile) const;
+
+                /*!
+                 * \brief Gives the mean of the recorded values
+                 * \return The mean in nanoseconds, 0 if there is no value
+                 */
+                inline double getMean() const { return m_count != 0 ? static_cast<double>(m_sum) / static_cast<double>(m_count) : 0.0; }
+
+                /*!
+                 * \brief Adds the values of another snapshot to this one, to combine histograms recorded separately
+                 * \param other The snapshot to add
+                 */
+                IKLOG_EXPORT void merge(const Snapshot& other);
+
+                inline uint64_t getCount() const { return m_count; }
+                inline const std::vector<uint64_t>& getBucketCounts() const { return m_bucketCounts; }
+
+            private:
+
+                friend class LatencyHistogram;
+
+                std::vector<uint64_t> m_bucketCounts; // number of values in each bucket
+                uint64_t m_count; // number of values
+                uint64_t m_sum; // sum of the values in nanoseconds
+        };
+
+
+        IKLOG_EXPORT LatencyHistogram();
+
+        LatencyHistogram(const LatencyHistogram&) = delete;
+        LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+        /*!
+         * \brief Records a value
+         * \param nanoseconds The value to record
+         */
+        inline void record(uint64_t nanoseconds)
+        {
+            m_buckets[getBucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+        }
+
+        /*!
+         * \brief Gives the values recorded so far
+         * \return The snapshot of the histogram
+         */
+        IKLOG_EXPORT Snapshot getSnapshot() const;
+
+
+        /*!
+         * \brief Gives the bucket counting a value
+         * \param value The value
+         * \return The index of the bucket
+         */
+        static constexpr size_t getBucketIndex(uint64_t value)
+        {
+            if(value < SUB_BUCKET_COUNT)
+                return static_cast<size_t>(value);
+
+            // the value shifted by the exponent keeps SUB_BUCKET_BITS + 1 bits, its highest bit being set
+            const unsigned int exponent = static_cast<unsigned int>(std::bit_width(value)) - SUB_BUCKET_BITS - 1;
+            const size_t index = SUB_BUCKET_COUNT * exponent + static_cast<size_t>(value >> exponent);
+            return index < BUCKET_COUNT ? index : BUCKET_COUNT - 1;
+        }
+
+        /*!
+         * \brief Gives the largest value counted by a bucket
+         * \param index The index of the bucket
+         * \return The largest value of the bucket
+         */
+        static constexpr uint64_t getBucketUpperBound(size_t index)
+        {
+            if(index < SUB_BUCKET_COUNT)
+                return index;
+
+            const size_t exponent = index / SUB_BUCKET_COUNT - 1;
+            const uint64_t mantissa = index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+            return ((mantissa + 1) << exponent) - 1;
+        }
+
+    private:
+
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_buckets; // number of values in each bucket
+        std::atomic<uint64_t> m_sum; // sum of the values in nanoseconds
+};
+
+}
+
+#endif // IKLOG_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,132 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_LOG_METRICS_HPP
+#define IKLOG_LOG_METRICS_HPP
+
+#include "LatencyHistogram.hpp"
+#include "../Level.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace iklog
+{
+
+/*!
+ * \brief Counters of an iklog::Log, updated with relaxed atomic operations
+ *
+ * The time spent logging each message is only measured once latency tracking has been enabled, as it requires
+ * reading the clock twice per message
+ */
+class LogMetrics
+{
+    public:
+
+        /*!
+         * \brief Values of the counters at a given time
+         */
+        struct Snapshot
+        {
+            std::array<uint64_t, LEVEL_COUNT> messages; // number of logged messages, by level index
+            uint64_t suppressedMessages; // number of messages suppressed by a rate limiter
+            uint64_t droppedMessages; // number of messages dropped, for example by an AsyncLog with a full queue
+            LatencyHistogram::Snapshot logLatency; // time spent to log the messages
+
+            inline uint64_t getMessages(Level level) const { return messages[getLevelIndex(level)]; }
+        };
+
+        /*!
+         * \brief Counts a logged message and measures the time spent to log it, for the duration of its scope
+         */
+        class LogScope
+        {
+            public:
+
+                inline LogScope(LogMetrics& metrics, Level level) :
+                    m_metrics(metrics),
+                    m_start(metrics.isTrackingLatency() ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point())
+                {
+                    m_metrics.m_messages[getLevelIndex(level)].fetch_add(1, std::memory_order_relaxed);
+                }
+
+                inline ~LogScope()
+                {
+                    if(m_start != std::chrono::steady_clock::time_point())
+                        m_metrics.m_logLatency.record(static_cast<uint64_t>(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count()));
+                }
+
+                LogScope(const LogScope&) = delete;
+                LogScope& operator=(const LogScope&) = delete;
+
+            private:
+
+                LogMetrics& m_metrics;
+                const std::chrono::steady_clock::time_point m_start; // default value if latency tracking is disabled
+        };
+
+
+        inline LogMetrics() :
+            m_messages(),
+            m_suppressedMessages(0),
+            m_droppedMessages(0),
+            m_trackingLatency(false)
+        {}
+
+        LogMetrics(const LogMetrics&) = delete;
+        LogMetrics& operator=(const LogMetrics&) = delete;
+
+        inline void countSuppressed() { m_suppressedMessages.fetch_add(1, std::memory_order_relaxed); }
+        inline void countDropped() { m_droppedMessages.fetch_add(1, std::memory_order_relaxed); }
+
+        inline uint64_t getDroppedCount() const { return m_droppedMessages.load(std::memory_order_relaxed); }
+
+        inline void setLatencyTracking(bool track) { m_trackingLatency.store(track, std::memory_order_relaxed); }
+        inline bool isTrackingLatency() const { return m_trackingLatency.load(std::memory_order_relaxed); }
+
+        /*!
+         * \brief Gives the values of the counters
+         * \return The snapshot of the counters
+         */
+        inline Snapshot getSnapshot() const
+        {
+            Snapshot snapshot;
+            for(size_t i = 0 ; i < LEVEL_COUNT ; i++)
+                snapshot.messages[i] = m_messages[i].load(std::memory_order_relaxed);
+
+            snapshot.suppressedMessages = m_suppressedMessages.load(std::memory_order_relaxed);
+            snapshot.droppedMessages = m_droppedMessages.load(std::memory_order_relaxed);
+            snapshot.logLatency = m_logLatency.getSnapshot();
+            return snapshot;
+        }
+
+    private:
+
+        std::array<std::atomic<uint64_t>, LEVEL_COUNT> m_messages; // number of logged messages, by level index
+        std::atomic<uint64_t> m_suppressedMessages;
+        std::atomic<uint64_t> m_droppedMessages;
+        std::atomic<bool> m_trackingLatency;
+        LatencyHistogram m_logLatency;
+};
+
+}
+
+#endif // IKLOG_LOG_METRICS_HPP
@@ -0,0 +1,142 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_OUTPUT_METRICS_HPP
+#define IKLOG_OUTPUT_METRICS_HPP
+
+#include "LatencyHistogram.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace iklog
+{
+
+/*!
+ * \brief Counters of an iklog::Output, updated with relaxed atomic operations
+ *
+ * The time spent writing each message is only measured once latency tracking has been enabled, as it requires
+ * reading the clock twice per message
+ */
+class OutputMetrics
+{
+    public:
+
+        /*!
+         * \brief Values of the counters at a given time
+         */
+        struct Snapshot
+        {
+            uint64_t messages; // number of messages written to the output
+            uint64_t bytes; // number of bytes written to the output
+            uint64_t flushes; // number of flushes
+            uint64_t rolls; // number of file rolls, for rolling outputs
+            uint64_t droppedMessages; // number of messages dropped, for example because a buffer was full
+            uint64_t writeErrors; // number of failed writes to the underlying file, whose data is lost
+            LatencyHistogram::Snapshot writeLatency; // time spent to write the messages
+        };
+
+        /*!
+         * \brief Counts a written message and measures the time spent to write it, for the duration of its scope
+         */
+        class WriteScope
+        {
+            public:
+
+                inline WriteScope(OutputMetrics& metrics, size_t bytes) :
+                    m_metrics(metrics),
+                    m_start(metrics.isTrackingLatency() ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point())
+                {
+                    m_metrics.m_messages.fetch_add(1, std::memory_order_relaxed);
+                    m_metrics.m_bytes.fetch_add(bytes, std::memory_order_relaxed);
+                }
+
+                inline ~WriteScope()
+                {
+                    if(m_start != std::chrono::steady_clock::time_point())
+                        m_metrics.m_writeLatency.record(static_cast<uint64_t>(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count()));
+                }
+
+                WriteScope(const WriteScope&) = delete;
+                WriteScope& operator=(const WriteScope&) = delete;
+
+            private:
+
+                OutputMetrics& m_metrics;
+                const std::chrono::steady_clock::time_point m_start; // default value if latency tracking is disabled
+        };
+
+
+        inline OutputMetrics() :
+            m_messages(0),
+            m_bytes(0),
+            m_flushes(0),
+            m_rolls(0),
+            m_droppedMessages(0),
+            m_writeErrors(0),
+            m_trackingLatency(false)
+        {}
+
+        OutputMetrics(const OutputMetrics&) = delete;
+        OutputMetrics& operator=(const OutputMetrics&) = delete;
+
+        inline void countFlush() { m_flushes.fetch_add(1, std::memory_order_relaxed); }
+        inline void countRoll() { m_rolls.fetch_add(1, std::memory_order_relaxed); }
+        inline void countDropped(uint64_t count = 1) { m_droppedMessages.fetch_add(count, std::memory_order_relaxed); }
+        inline void countWriteError() { m_writeErrors.fetch_add(1, std::memory_order_relaxed); }
+
+        inline uint64_t getDroppedCount() const { return m_droppedMessages.load(std::memory_order_relaxed); }
+
+        inline void setLatencyTracking(bool track) { m_trackingLatency.store(track, std::memory_order_relaxed); }
+        inline bool isTrackingLatency() const { return m_trackingLatency.load(std::memory_order_relaxed); }
+
+        /*!
+         * \brief Gives the values of the counters
+         * \return The snapshot of the counters
+         */
+        inline Snapshot getSnapshot() const
+        {
+            Snapshot snapshot;
+            snapshot.messages = m_messages.load(std::memory_order_relaxed);
+            snapshot.bytes = m_bytes.load(std::memory_order_relaxed);
+            snapshot.flushes = m_flushes.load(std::memory_order_relaxed);
+            snapshot.rolls = m_rolls.load(std::memory_order_relaxed);
+            snapshot.droppedMessages = m_droppedMessages.load(std::memory_order_relaxed);
+            snapshot.writeErrors = m_writeErrors.load(std::memory_order_relaxed);
+            snapshot.writeLatency = m_writeLatency.getSnapshot();
+            return snapshot;
+        }
+
+    private:
+
+        std::atomic<uint64_t> m_messages;
+        std::atomic<uint64_t> m_bytes;
+        std::atomic<uint64_t> m_flushes;
+        std::atomic<uint64_t> m_rolls;
+        std::atomic<uint64_t> m_droppedMessages;
+        std::atomic<uint64_t> m_writeErrors;
+        std::atomic<bool> m_trackingLatency;
+        LatencyHistogram m_writeLatency;
+};
+
+}
+
+#endif // IKLOG_OUTPUT_METRICS_HPP
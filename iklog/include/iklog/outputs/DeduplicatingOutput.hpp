@@ -0,0 +1,133 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_DEDUPLICATING_OUTPUT_HPP
+#define IKLOG_DEDUPLICATING_OUTPUT_HPP
+
+#include "Output.hpp"
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace iklog
+{
+
+/*!
+ * \brief Output collapsing consecutive identical messages into a single line followed by a repeat counter
+ *
+ * The first message of a series is written to the wrapped output. The next identical messages, that is with the same
+ * log name, level, text and fields, logged by the same thread with the same context (see ThreadContext), are only counted. A line telling how many times the message has been repeated is written
+ * when a different message arrives, when the output is flushed, or when it is destroyed, the next identical message
+ * then starting a new series. This line is not formatted by the Log, it only has the log name and level of the series.
+ *
+ * The output is flushed periodically with the repeat timeout, so a series is reported at most a timeout after its end.
+ * Changing the flush policy changes when the counter of a series that is still going on is reported.
+ * Messages without text, such as the ones written by a ShardedOutput, are compared by their formatted data
+ */
+class DeduplicatingOutput : public Output
+{
+    public:
+
+        static constexpr std::chrono::milliseconds DEFAULT_REPEAT_TIMEOUT{1000}; //! default maximum time before a repeat counter is written
+
+        /*!
+         * \brief Constructor
+         * \param output The output to write the messages to, must outlive the DeduplicatingOutput
+         * \param repeatTimeout The maximum time before the counter of repeated messages is written
+         */
+        IKLOG_EXPORT DeduplicatingOutput(Output& output, std::chrono::milliseconds repeatTimeout = DEFAULT_REPEAT_TIMEOUT);
+
+        /*!
+         * \brief Destructor, writes the counter of repeated messages if there is one
+         */
+        IKLOG_EXPORT virtual ~DeduplicatingOutput();
+
+        /*!
+         * \brief Writes a formatted message to the wrapped output, unless it is the same as the previous one
+         * \param message The message that has been formatted
+         * \param formatted The formatted message, including its line ending
+         */
+        IKLOG_EXPORT virtual void write(const Message& message, std::string_view formatted) override;
+
+        /*!
+         * \brief Writes the counter of repeated messages if there is one, then flushes the wrapped output
+         */
+        IKLOG_EXPORT virtual void flush() override;
+
+
+        /*!
+         * \brief Gives the number of messages that have not been written because they were repeated
+         * \return The number of collapsed messages
+         */
+        IKLOG_EXPORT uint64_t getCollapsedCount();
+
+    protected:
+
+        /*!
+         * \brief Writes data to the wrapped output, as a message logged now in the lowest level
+         * \param data The data to write
+         */
+        IKLOG_EXPORT virtual void doWrite(std::string_view data) override;
+
+        /*!
+         * \brief Writes the counter of repeated messages if there is one, then flushes the wrapped output
+         */
+        IKLOG_EXPORT virtual void doFlush() override;
+
+    private:
+
+        using StoredValue = std::variant<std::string, int64_t, uint64_t, double, bool>; // copy of the value of a Field
+
+        /*!
+         * \brief Tells whether the fields of a message are the ones of the current series
+         * \param fields The fields of the message
+         * \return True if the fields have the same keys and values, in the same order
+         */
+        bool isSameFields(std::span<const Field> fields) const;
+
+        /*!
+         * \brief Keeps a copy of the fields of the message starting a series
+         * \param fields The fields of the message
+         */
+        void storeFields(std::span<const Field> fields);
+
+        /*!
+         * \brief Writes the counter of repeated messages to the wrapped output and ends the series, if there are repeated messages
+         */
+        void writeRepeatCount();
+
+
+        Output& m_output;
+        bool m_hasLastMessage; // whether a series of messages has started
+        std::string m_lastLogName; // log name of the messages of the current series
+        Level m_lastLevel; // level of the messages of the current series
+        std::string m_lastMessage; // text of the messages of the current series
+        std::vector<std::pair<std::string, StoredValue>> m_lastFields; // fields of the messages of the current series
+        uint64_t m_lastContextVersion; // version of the thread context of the messages of the current series
+        uint64_t m_repeatCount; // number of messages of the current series that have not been written
+        uint64_t m_collapsedCount; // number of messages that have not been written since the creation of the output
+};
+
+}
+
+#endif // IKLOG_DEDUPLICATING_OUTPUT_HPP
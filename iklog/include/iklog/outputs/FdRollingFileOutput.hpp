@@ -0,0 +1,227 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_FD_ROLLING_FILE_OUTPUT_HPP
+#define IKLOG_FD_ROLLING_FILE_OUTPUT_HPP
+
+#include "Output.hpp"
+#include "iklog/files/FileSize.hpp"
+#include "iklog/files/RollingFileNames.hpp"
+#include <ikgen/Result.hpp>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace iklog
+{
+
+/*!
+ * \brief Outputs logging messages to a file, with a rolling system, without going through iostreams
+ *
+ * Uses the same rolling system as RollingFileOutput, but writes to a file descriptor opened in append mode,
+ * through its own write buffer: the data is given to the system when the buffer is full or when the output is flushed,
+ * so it is better used with a flush policy that does not flush every message.
+ * The file size is known exactly from the written bytes, so the file system is never queried while logging.
+ * A file is rolled before it would exceed the maximum size, unless a single message is larger than this size
+ * or the background thread has not finished the previous rolling yet.
+ * Like RollingFileOutput, the next file is opened in advance and the rolling itself is done by a background thread,
+ * except on Windows where the logging thread does the rolling.
+ * Optionally, the disk space of each new file can be reserved up front to avoid fragmentation (only on Linux).
+ */
+class FdRollingFileOutput : public Output
+{
+    public:
+
+        static constexpr std::size_t DEFAULT_BUFFER_SIZE = 64 * 1024; //! default size of the write buffer, in bytes
+
+        /*!
+         * \brief Creates a new instance of FdRollingFileOutput. Same as constructors but returns a Result
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxFileSize The maximum size for each logging file, a new file is created when reached
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         * \param bufferSize The size of the write buffer in bytes
+         * \param preallocate Whether to reserve the maximum file size on disk for each new file
+         * \return Either the newly created FdRollingFileOutput in case of success, or an error message otherwise
+         */
+        template<unsigned short MULTIPLIER>
+        static ikgen::Result<FdRollingFileOutput, std::string> create(const std::string& baseFilename, const FileSize<MULTIPLIER>& maxFileSize,
+                                                                      unsigned int maxRollingFiles, std::size_t bufferSize = DEFAULT_BUFFER_SIZE,
+                                                                      bool preallocate = false)
+        {
+            try
+            {
+                return ikgen::Result<FdRollingFileOutput, std::string>::makeSuccess(baseFilename, maxFileSize.toBytes(), maxRollingFiles,
+                                                                                    bufferSize, preallocate);
+            }
+            catch(const std::runtime_error& e)
+            {
+                return ikgen::Result<FdRollingFileOutput, std::string>::makeFailure(e.what());
+            }
+        }
+
+        /*!
+         * \brief Constructor, throws std::runtime_error if a problem occurs
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxFileSize The maximum size in bytes for each logging file, a new file is created when reached
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         * \param bufferSize The size of the write buffer in bytes
+         * \param preallocate Whether to reserve the maximum file size on disk for each new file
+         */
+        IKLOG_EXPORT FdRollingFileOutput(const std::string& baseFilename, const Bytes& maxFileSize, unsigned int maxRollingFiles,
+                                         std::size_t bufferSize = DEFAULT_BUFFER_SIZE, bool preallocate = false);
+
+        /*!
+         * \brief Constructor, throws std::runtime_error if a problem occurs
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxFileSize The maximum size in kilobytes for each logging file, a new file is created when reached
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         * \param bufferSize The size of the write buffer in bytes
+         * \param preallocate Whether to reserve the maximum file size on disk for each new file
+         */
+        IKLOG_EXPORT FdRollingFileOutput(const std::string& baseFilename, const KiloBytes& maxFileSize, unsigned int maxRollingFiles,
+                                         std::size_t bufferSize = DEFAULT_BUFFER_SIZE, bool preallocate = false);
+
+        /*!
+         * \brief Constructor, throws std::runtime_error if a problem occurs
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxFileSize The maximum size in megabytes for each logging file, a new file is created when reached
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         * \param bufferSize The size of the write buffer in bytes
+         * \param preallocate Whether to reserve the maximum file size on disk for each new file
+         */
+        IKLOG_EXPORT FdRollingFileOutput(const std::string& baseFilename, const MegaBytes& maxFileSize, unsigned int maxRollingFiles,
+                                         std::size_t bufferSize = DEFAULT_BUFFER_SIZE, bool preallocate = false);
+
+        /*!
+         * \brief Constructor, throws std::runtime_error if a problem occurs
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxFileSize The maximum size in gigabytes for each logging file, a new file is created when reached
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         * \param bufferSize The size of the write buffer in bytes
+         * \param preallocate Whether to reserve the maximum file size on disk for each new file
+         */
+        IKLOG_EXPORT FdRollingFileOutput(const std::string& baseFilename, const GigaBytes& maxFileSize, unsigned int maxRollingFiles,
+                                         std::size_t bufferSize = DEFAULT_BUFFER_SIZE, bool preallocate = false);
+
+        IKLOG_EXPORT virtual ~FdRollingFileOutput();
+
+        /*!
+         * \brief Sets whether the rolled files are compressed, by the background thread (see iklog::lz)
+         *
+         * A rolled file is compressed when it becomes the file with index 1, it is then named like "myfile.log.1.lz".
+         * The files remain compressed while they are rolled. Disabled by default
+         * \param compress True to compress the rolled files
+         */
+        IKLOG_EXPORT void setRolledFilesCompression(bool compress);
+
+        /*!
+         * \brief Tells whether the rolled files are compressed
+         * \return True if the rolled files are compressed
+         */
+        IKLOG_EXPORT bool isCompressingRolledFiles();
+
+        /*!
+         * \brief Gives the exact size of the current file, including the data still in the write buffer
+         * \return The size of the current file in bytes
+         */
+        IKLOG_EXPORT uintmax_t getFileSize();
+
+    protected:
+
+        /*!
+         * \brief Adds the given data to the write buffer, rolling the files first if the current one would become too large
+         * \param data The data to write
+         */
+        IKLOG_EXPORT virtual void doWrite(std::string_view data) override;
+
+        /*!
+         * \brief Writes the content of the write buffer to the current file
+         */
+        IKLOG_EXPORT virtual void doFlush() override;
+
+    private:
+
+        /*!
+         * \brief Constructor
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         * \param maxFileSize The maximum size in bytes for each logging file, a new file is created when reached
+         * \param bufferSize The size of the write buffer in bytes
+         * \param preallocate Whether to reserve the maximum file size on disk for each new file
+         */
+        FdRollingFileOutput(const std::string& baseFilename, unsigned int maxRollingFiles, uintmax_t maxFileSize,
+                            std::size_t bufferSize, bool preallocate);
+
+        /*!
+         * \brief Opens the first file of the rolling system, reads its current size and opens the next file,
+         * throws std::runtime_error on failure
+         */
+        void open();
+
+        /*!
+         * \brief Opens a new next file and reserves its disk space if needed
+         * \return True if the file could be opened
+         */
+        bool openNextFile();
+
+        /*!
+         * \brief Flushes the write buffer, switches to the next file and lets the background thread roll the files
+         */
+        void roll();
+
+        /*!
+         * \brief Lets the background thread close the previous file, roll the files if needed and open a new next file
+         * \param previousFd The descriptor of the previous file to close, or -1
+         * \param previousSize The size of the previous file
+         */
+        void prepareNextFile(int previousFd, uintmax_t previousSize);
+
+        /*!
+         * \brief Tells whether the next file is ready to be used, prepares it again if its preparation failed
+         * \return True if the output can switch to the next file
+         */
+        bool isNextFileReady();
+
+        /*!
+         * \brief Writes the given data to the current file, retrying on interruptions and partial writes
+         * \param data Pointer to the data to write
+         * \param length Length of the data
+         */
+        void writeToFile(const char* data, std::size_t length);
+
+
+        int m_fd; // descriptor of the current file we write to
+        int m_nextFd; // descriptor of the file opened in advance to switch to when rolling
+        std::future<void> m_nextFilePreparation; // completion of the background preparation of the next file
+        bool m_nextFileInUse; // whether we write to the next file, which is not renamed yet
+        bool m_compressRolledFiles; // whether the rolled files are compressed
+        const uintmax_t m_maxFileSize; // maximum file size after which a rolling is performed
+        uintmax_t m_fileSize; // exact size of the current file, including the buffered data
+        const bool m_preallocate; // whether the disk space of each new file is reserved
+
+        std::unique_ptr<char[]> m_buffer; // write buffer
+        const std::size_t m_bufferCapacity; // size of the write buffer
+        std::size_t m_bufferLength; // length of the data currently in the write buffer
+
+        const internal::RollingFileNames m_fileNames; // names of the files in the rolling system
+};
+
+}
+
+#endif // IKLOG_FD_ROLLING_FILE_OUTPUT_HPP
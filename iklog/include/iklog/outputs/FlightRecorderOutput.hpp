@@ -0,0 +1,166 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_FLIGHT_RECORDER_OUTPUT_HPP
+#define IKLOG_FLIGHT_RECORDER_OUTPUT_HPP
+
+#include "Output.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace iklog
+{
+
+/*!
+ * \brief Output keeping the last formatted messages in memory, to write them to another output only when needed
+ *
+ * The messages are copied to a fixed size ring buffer, the oldest ones being overwritten, so keeping the messages
+ * of all levels costs nearly nothing. The content of the buffer is written to the dump output, then cleared:
+ * - when a message in one of the dump levels is written, after this message
+ * - when dump is called
+ * - when the program receives a fatal signal, if dumpOnFatalSignals has been called (the data is then written as is
+ *   to a file descriptor)
+ *
+ * The dump output receives messages with their level and clock time, but without log name nor text:
+ * the formatted message is given as data
+ */
+class FlightRecorderOutput : public Output
+{
+    public:
+
+        static constexpr size_t DEFAULT_CAPACITY = 1024 * 1024; //! default size of the ring buffer, in bytes
+
+        /*!
+         * \brief Constructor
+         * \param dumpOutput The output to write the recorded messages to, must outlive the FlightRecorderOutput
+         * \param capacity The size of the ring buffer in bytes
+         * \param dumpLevels List of flags describing the levels whose messages trigger a dump
+         */
+        IKLOG_EXPORT FlightRecorderOutput(Output& dumpOutput, size_t capacity = DEFAULT_CAPACITY, int dumpLevels = Level::ERROR);
+
+        IKLOG_EXPORT virtual ~FlightRecorderOutput();
+
+        /*!
+         * \brief Records a formatted message, then dumps the recorded messages if its level is a dump level
+         * \param message The message that has been formatted
+         * \param formatted The formatted message, including its line ending
+         */
+        IKLOG_EXPORT virtual void write(const Message& message, std::string_view formatted) override;
+
+        /*!
+         * \brief Does nothing, the messages are kept in memory until they are dumped
+         */
+        IKLOG_EXPORT virtual void flush() override;
+
+
+        /*!
+         * \brief Writes the recorded messages to the dump output and flushes it, then forgets them
+         */
+        IKLOG_EXPORT void dump();
+
+        /*!
+         * \brief Writes the recorded messages to a file descriptor, without locking nor allocating memory
+         *
+         * Can be called from a signal handler. The messages are not forgotten, and a message being recorded by another
+         * thread at the same time may be written partially
+         * \param fd The file descriptor to write to
+         */
+        IKLOG_EXPORT void dumpToFileDescriptor(int fd) const;
+
+        /*!
+         * \brief Dumps the recorded messages to a file descriptor when the program receives a fatal signal
+         *
+         * Handles SIGSEGV, SIGABRT, SIGFPE, SIGILL and SIGBUS where it exists. After the dump, the signal is raised again
+         * with its default handler. Only one FlightRecorderOutput is dumped on fatal signals: the last one this method
+         * has been called on
+         * \param fd The file descriptor to write to, the standard error by default
+         */
+        IKLOG_EXPORT void dumpOnFatalSignals(int fd = 2);
+
+    protected:
+
+        /*!
+         * \brief Records data, as a message logged now in the lowest level
+         * \param data The data to write
+         */
+        IKLOG_EXPORT virtual void doWrite(std::string_view data) override;
+
+        /*!
+         * \brief Does nothing, the messages are kept in memory until they are dumped
+         */
+        IKLOG_EXPORT virtual void doFlush() override;
+
+    private:
+
+        /*!
+         * \brief Header of a message in the ring buffer, followed by the formatted message
+         */
+        struct RecordHeader
+        {
+            Message::TimePoint clockTime;
+            uint32_t size;
+            Level level;
+        };
+
+
+        /*!
+         * \brief Copies a message at the end of the ring buffer, removing the oldest messages to make room
+         * \param clockTime The time of the message
+         * \param level The level of the message
+         * \param formatted The formatted message, truncated if it does not fit in the ring buffer
+         */
+        void record(const Message::TimePoint& clockTime, Level level, std::string_view formatted);
+
+        /*!
+         * \brief Writes the recorded messages to the dump output then forgets them, called with the mutex locked
+         */
+        void dumpRecords();
+
+        /*!
+         * \brief Copies data to the ring buffer, going back to its beginning when its end is reached
+         * \param offset The position in the ring buffer
+         * \param data The data to copy
+         * \param size The size of the data
+         */
+        void copyToRing(size_t offset, const void* data, size_t size);
+
+        /*!
+         * \brief Copies data from the ring buffer, going back to its beginning when its end is reached
+         * \param offset The position in the ring buffer
+         * \param data The destination of the data
+         * \param size The size of the data
+         */
+        void copyFromRing(size_t offset, void* data, size_t size) const;
+
+
+        Output& m_dumpOutput;
+        const size_t m_capacity;
+        const int m_dumpLevels;
+        std::unique_ptr<char[]> m_ring; // recorded messages, each one preceded by its header
+        std::atomic<size_t> m_begin; // position of the oldest message in the ring, atomic to be read by signal handlers
+        std::atomic<size_t> m_size; // number of bytes used in the ring, atomic to be read by signal handlers
+        std::string m_dumpBuffer; // contiguous copy of the message being dumped
+};
+
+}
+
+#endif // IKLOG_FLIGHT_RECORDER_OUTPUT_HPP
@@ -0,0 +1,140 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_FLUSH_POLICY_HPP
+#define IKLOG_FLUSH_POLICY_HPP
+
+#include "../Level.hpp"
+#include <chrono>
+#include <cstddef>
+
+namespace iklog
+{
+
+/*!
+ * \brief Defines when an iklog::Output flushes the messages written to it
+ *
+ * An output flushes as soon as one of the configured conditions is met:
+ * - a number of messages has been written since the last flush
+ * - a number of bytes has been written since the last flush
+ * - a message in one of the immediate levels has been written
+ * - the periodic interval has elapsed (done by a background thread shared by all the outputs)
+ */
+class FlushPolicy
+{
+    public:
+
+        /*!
+         * \brief Flushes after each message, this is the default policy of the outputs
+         * \return The flush policy
+         */
+        static inline FlushPolicy everyMessage() { return everyMessages(1); }
+
+        /*!
+         * \brief Flushes once a number of messages have been written
+         * \param count The number of messages between two flushes
+         * \return The flush policy
+         */
+        static inline FlushPolicy everyMessages(size_t count) { FlushPolicy policy; policy.m_maxPendingMessages = count; return policy; }
+
+        /*!
+         * \brief Flushes once a number of bytes have been written
+         * \param bytes The number of bytes between two flushes
+         * \return The flush policy
+         */
+        static inline FlushPolicy everyBytes(size_t bytes) { FlushPolicy policy; policy.m_maxPendingBytes = bytes; return policy; }
+
+        /*!
+         * \brief Flushes periodically
+         * \param interval The time between two flushes
+         * \return The flush policy
+         */
+        static inline FlushPolicy periodic(std::chrono::milliseconds interval) { FlushPolicy policy; policy.m_interval = interval; return policy; }
+
+        /*!
+         * \brief Never flushes on its own, unless other conditions are added
+         * \return The flush policy
+         */
+        static inline FlushPolicy never() { return FlushPolicy(); }
+
+
+        /*!
+         * \brief Adds levels whose messages are flushed as soon as they are written
+         * \param levels List of flags describing the levels
+         * \return This policy
+         */
+        inline FlushPolicy& withImmediateLevels(int levels) { m_immediateLevels |= levels; return *this; }
+
+        /*!
+         * \brief Adds a maximum number of messages between two flushes
+         * \param count The number of messages
+         * \return This policy
+         */
+        inline FlushPolicy& withMaxMessages(size_t count) { m_maxPendingMessages = count; return *this; }
+
+        /*!
+         * \brief Adds a maximum number of bytes between two flushes
+         * \param bytes The number of bytes
+         * \return This policy
+         */
+        inline FlushPolicy& withMaxBytes(size_t bytes) { m_maxPendingBytes = bytes; return *this; }
+
+        /*!
+         * \brief Adds a periodic flush
+         * \param interval The time between two flushes
+         * \return This policy
+         */
+        inline FlushPolicy& withInterval(std::chrono::milliseconds interval) { m_interval = interval; return *this; }
+
+
+        /*!
+         * \brief Tells whether the output has to be flushed after writing a message
+         * \param pendingMessages Number of messages written since the last flush
+         * \param pendingBytes Number of bytes written since the last flush
+         * \param level Level of the last written message
+         * \return True if the output has to be flushed
+         */
+        inline bool shouldFlush(size_t pendingMessages, size_t pendingBytes, Level level) const
+        {
+            return (m_immediateLevels & level) != 0 ||
+                   (m_maxPendingMessages != 0 && pendingMessages >= m_maxPendingMessages) ||
+                   (m_maxPendingBytes != 0 && pendingBytes >= m_maxPendingBytes);
+        }
+
+        inline bool isPeriodic() const { return m_interval.count() > 0; }
+        inline const std::chrono::milliseconds& getInterval() const { return m_interval; }
+
+    private:
+
+        FlushPolicy() :
+            m_maxPendingMessages(0),
+            m_maxPendingBytes(0),
+            m_interval(0),
+            m_immediateLevels(0)
+        {}
+
+        size_t m_maxPendingMessages; // maximum number of messages between two flushes, 0 if unlimited
+        size_t m_maxPendingBytes; // maximum number of bytes between two flushes, 0 if unlimited
+        std::chrono::milliseconds m_interval; // time between two periodic flushes, 0 if there is no periodic flush
+        int m_immediateLevels; // levels whose messages are flushed immediately
+};
+
+}
+
+#endif // IKLOG_FLUSH_POLICY_HPP
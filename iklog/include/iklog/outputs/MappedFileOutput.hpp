@@ -0,0 +1,230 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_MAPPED_FILE_OUTPUT_HPP
+#define IKLOG_MAPPED_FILE_OUTPUT_HPP
+
+#include "Output.hpp"
+#include "iklog/files/FileSize.hpp"
+#include "iklog/files/RollingFileNames.hpp"
+#include <ikgen/Result.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+
+namespace iklog
+{
+
+/*!
+ * \brief Outputs logging messages to memory mapped files, with a rolling system
+ *
+ * Each file is created with the maximum file size and mapped in memory, so writing a message is only a copy,
+ * without any system call. The written data is visible to other processes right away, and is synchronized to the disk
+ * when the output is flushed: by default every second by a background thread (see FlushPolicy::periodic).
+ * Flushing does not block the logging threads.
+ *
+ * Uses the same rolling system as RollingFileOutput: when a message does not fit in the current file anymore,
+ * the output switches to the next file, mapped in advance, and a background thread unmaps the previous file,
+ * truncates it to its actual size and rolls the files. If the next file is not ready yet, the logging thread waits for it.
+ * Available on POSIX systems only, the constructor fails on other systems.
+ */
+class MappedFileOutput : public Output
+{
+    public:
+
+        static constexpr std::chrono::milliseconds DEFAULT_SYNC_INTERVAL{1000}; //! default interval between the synchronizations to the disk
+
+        /*!
+         * \brief Creates a new instance of MappedFileOutput. Same as constructors but returns a Result
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxFileSize The size of each logging file, a new file is created when reached
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         * \return Either the newly created MappedFileOutput in case of success, or an error message otherwise
+         */
+        template<unsigned short MULTIPLIER>
+        static ikgen::Result<MappedFileOutput, std::string> create(const std::string& baseFilename, const FileSize<MULTIPLIER>& maxFileSize,
+                                                                   unsigned int maxRollingFiles)
+        {
+            try
+            {
+                return ikgen::Result<MappedFileOutput, std::string>::makeSuccess(baseFilename, maxFileSize.toBytes(), maxRollingFiles);
+            }
+            catch(const std::runtime_error& e)
+            {
+                return ikgen::Result<MappedFileOutput, std::string>::makeFailure(e.what());
+            }
+        }
+
+        /*!
+         * \brief Constructor, throws std::runtime_error if a problem occurs
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxFileSize The size in bytes of each logging file, a new file is created when reached
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         */
+        IKLOG_EXPORT MappedFileOutput(const std::string& baseFilename, const Bytes& maxFileSize, unsigned int maxRollingFiles);
+
+        /*!
+         * \brief Constructor, throws std::runtime_error if a problem occurs
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxFileSize The size in kilobytes of each logging file, a new file is created when reached
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         */
+        IKLOG_EXPORT MappedFileOutput(const std::string& baseFilename, const KiloBytes& maxFileSize, unsigned int maxRollingFiles);
+
+        /*!
+         * \brief Constructor, throws std::runtime_error if a problem occurs
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxFileSize The size in megabytes of each logging file, a new file is created when reached
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         */
+        IKLOG_EXPORT MappedFileOutput(const std::string& baseFilename, const MegaBytes& maxFileSize, unsigned int maxRollingFiles);
+
+        /*!
+         * \brief Constructor, throws std::runtime_error if a problem occurs
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxFileSize The size in gigabytes of each logging file, a new file is created when reached
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         */
+        IKLOG_EXPORT MappedFileOutput(const std::string& baseFilename, const GigaBytes& maxFileSize, unsigned int maxRollingFiles);
+
+        IKLOG_EXPORT virtual ~MappedFileOutput();
+
+        /*!
+         * \brief Synchronizes the data written since the previous flush to the disk
+         *
+         * The synchronization itself is done without holding the mutex of the output: meanwhile, a rolling can switch
+         * to the next file, but the background thread waits for the synchronization to end before unmapping the previous one
+         */
+        IKLOG_EXPORT virtual void flush() override;
+
+        /*!
+         * \brief Sets whether the rolled files are compressed, by the background thread (see iklog::lz)
+         *
+         * A rolled file is compressed when it becomes the file with index 1, it is then named like "myfile.log.1.lz".
+         * The files remain compressed while they are rolled. Disabled by default
+         * \param compress True to compress the rolled files
+         */
+        IKLOG_EXPORT void setRolledFilesCompression(bool compress);
+
+        /*!
+         * \brief Tells whether the rolled files are compressed
+         * \return True if the rolled files are compressed
+         */
+        IKLOG_EXPORT bool isCompressingRolledFiles();
+
+    protected:
+
+        /*!
+         * \brief Copies the given data to the mapping of the current file, rolling the files first if it does not fit
+         *
+         * Data larger than the maximum file size is truncated
+         * \param data The data to write
+         */
+        IKLOG_EXPORT virtual void doWrite(std::string_view data) override;
+
+        /*!
+         * \brief Asks the system to write the data to the disk, without waiting for it
+         */
+        IKLOG_EXPORT virtual void doFlush() override;
+
+    private:
+
+        /*!
+         * \brief A file mapped in memory
+         */
+        struct Mapping
+        {
+            int fd; // descriptor of the file
+            char* data; // start of the mapping, nullptr if the file is not mapped
+        };
+
+
+        /*!
+         * \brief Constructor
+         * \param baseFilename The file name without the rolling system extension, for example "myfile.log"
+         * \param maxRollingFiles The maximum number of files, the oldest file is removed when reached
+         * \param maxFileSize The size in bytes of each logging file, a new file is created when reached
+         */
+        MappedFileOutput(const std::string& baseFilename, unsigned int maxRollingFiles, uintmax_t maxFileSize);
+
+        /*!
+         * \brief Maps the first file of the rolling system, continuing after its existing data, and maps the next file,
+         * throws std::runtime_error on failure
+         */
+        void open();
+
+        /*!
+         * \brief Opens a file, reserves the file size on disk and maps it in memory
+         * \param filename The name of the file
+         * \param truncate Whether to remove the existing data of the file
+         * \param mapping [out] The mapping of the file
+         * \param dataSize [out] The size of the existing data in the file
+         * \return True in case of success, false otherwise
+         */
+        bool mapFile(const std::string& filename, bool truncate, Mapping& mapping, size_t& dataSize) const;
+
+        /*!
+         * \brief Synchronizes a mapped file to the disk, unmaps it, truncates it to the size of its data and closes it
+         * \param mapping [in,out] The mapping to release, reset to an unmapped state
+         * \param dataSize The size of the data in the file
+         */
+        void releaseMapping(Mapping& mapping, size_t dataSize) const;
+
+        /*!
+         * \brief Switches to the next file and lets the background thread roll the files
+         */
+        void roll();
+
+        /*!
+         * \brief Prepares the next file: unmaps the previous file, rolls the files if needed and maps a new next file
+         * \param previous The mapping of the previous file to release, if any
+         * \param previousSize The actual size of the data in the previous file
+         */
+        void prepareNextFile(Mapping previous, size_t previousSize);
+
+        /*!
+         * \brief Waits for the next file to be ready, prepares it in this thread if its preparation failed
+         * \return True if the output can switch to the next file
+         */
+        bool waitNextFile();
+
+
+        Mapping m_mapping; // current file we write to
+        Mapping m_nextMapping; // file mapped in advance to switch to when rolling
+        std::future<void> m_nextFilePreparation; // completion of the background preparation of the next file
+        bool m_nextFileInUse; // whether we write to the next file, which is not renamed yet
+        bool m_compressRolledFiles; // whether the rolled files are compressed
+
+        const size_t m_maxFileSize; // size of the files
+        size_t m_position; // size of the data written to the current file
+        size_t m_syncedPosition; // size of the data synchronized to the disk in the current file
+        size_t m_rollCount; // number of rollings done, tells a flush whether the file it synchronized is still the current one
+
+        std::mutex m_syncMutex; // protects the count of synchronizations in progress, not held during the synchronizations
+        std::condition_variable m_syncCondition; // notified when a synchronization ends
+        unsigned int m_syncCount; // number of synchronizations in progress, the mappings are not released meanwhile
+
+        const internal::RollingFileNames m_fileNames; // names of the files in the rolling system
+};
+
+}
+
+#endif // IKLOG_MAPPED_FILE_OUTPUT_HPP
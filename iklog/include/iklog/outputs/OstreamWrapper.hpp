@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, InternationalKoder
+    Copyright (C) 2019, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -21,6 +21,7 @@
 #define IKLOG_OSTREAM_WRAPPER_HPP
 
 #include "Output.hpp"
+#include <ostream>
 
 namespace iklog
 {
@@ -36,13 +37,20 @@ namespace iklog
             IKLOG_EXPORT static OstreamWrapper CLOG; //! wrapper for std::clog
 
             IKLOG_EXPORT OstreamWrapper(std::ostream& ostream);
+            IKLOG_EXPORT virtual ~OstreamWrapper();
+
+        protected:
+
+            /*!
+             * \brief Writes the given data on the wrapped std::ostream
+             * \param data The data to write
+             */
+            virtual inline void doWrite(std::string_view data) override { m_ostream->write(data.data(), static_cast<std::streamsize>(data.size())); }
 
             /*!
-             * \brief Writes the given message on the wrapped std::ostream
-             * \param message The message to write
-             * \return The wrapped stream on which the message has been written
+             * \brief Flushes the wrapped std::ostream
              */
-            virtual inline std::ostream& write(const std::string& message) { return *m_ostream << message; }
+            virtual inline void doFlush() override { m_ostream->flush(); }
 
         private:
 
@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, 2023, InternationalKoder
+    Copyright (C) 2019, 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -20,9 +20,12 @@
 #ifndef IKLOG_OUTPUT_HPP
 #define IKLOG_OUTPUT_HPP
 
-#include <string>
-#include <ostream>
+#include "FlushPolicy.hpp"
+#include "../metrics/OutputMetrics.hpp"
+#include "../Message.hpp"
 #include "../iklog_export.hpp"
+#include <mutex>
+#include <string_view>
 
 namespace iklog
 {
@@ -30,7 +33,11 @@ namespace iklog
 /*!
  * \brief Base class for iklog outputs
  *
- * Abstract class that defines the base of a iklog output system
+ * Abstract class that defines the base of a iklog output system.
+ * Writing and flushing are protected by a mutex, so an output can be shared by several threads.
+ * The messages are flushed according to the flush policy of the output, which flushes after each message by default.
+ *
+ * Concrete outputs implement doWrite and doFlush, and must call stopPeriodicFlush at the beginning of their destructor
  */
 class Output
 {
@@ -39,15 +46,75 @@ class Output
         IKLOG_EXPORT Output();
         IKLOG_EXPORT virtual ~Output();
 
+        Output(const Output&) = delete;
+        Output& operator=(const Output&) = delete;
+
         /*!
-         * \brief Writes the given string to the output
-         * \param message The string to write
-         * \return A stream stream on which the message has been written
+         * \brief Writes a formatted message to the output, then flushes it if required by the flush policy
+         * \param message The message that has been formatted
+         * \param formatted The formatted message, including its line ending
          */
-        virtual std::ostream& write(const std::string& message) = 0;
-};
+        IKLOG_EXPORT virtual void write(const Message& message, std::string_view formatted);
+
+        /*!
+         * \brief Flushes the messages written to the output
+         */
+        IKLOG_EXPORT virtual void flush();
+
+
+        /*!
+         * \brief Changes the flush policy of the output
+         * \param flushPolicy The new flush policy
+         */
+        IKLOG_EXPORT void setFlushPolicy(const FlushPolicy& flushPolicy);
+
+        inline const FlushPolicy& getFlushPolicy() const { return m_flushPolicy; }
+
+
+        /*!
+         * \brief Gives the values of the counters of the output: messages, bytes, flushes, rolls, drops and write latency
+         * \return The snapshot of the counters
+         */
+        inline OutputMetrics::Snapshot getMetrics() const { return m_metrics.getSnapshot(); }
+
+        /*!
+         * \brief Sets whether the time spent writing each message is measured, disabled by default
+         * \param track True to measure the write latency
+         */
+        inline void setLatencyTracking(bool track) { m_metrics.setLatencyTracking(track); }
+
+    protected:
+
+        /*!
+         * \brief Actually writes data to the output, called with the mutex locked
+         * \param data The data to write
+         */
+        virtual void doWrite(std::string_view data) = 0;
+
+        /*!
+         * \brief Actually flushes the output, called with the mutex locked
+         */
+        virtual void doFlush() = 0;
+
+        /*!
+         * \brief Stops the periodic flush of the output if there is one, and waits for a periodic flush in progress
+         *
+         * Must be called at the beginning of the destructor of concrete outputs, so the background thread
+         * does not flush an output being destroyed
+         */
+        IKLOG_EXPORT void stopPeriodicFlush();
 
-std::ostream& operator<<(Output& output, const std::string& message);
+
+        std::mutex m_mutex; // protects the output from concurrent writings
+        OutputMetrics m_metrics; // counters of the output, also updated by the outputs overriding write
+
+    private:
+
+        FlushPolicy m_flushPolicy;
+        size_t m_pendingMessages; // number of messages written since the last flush
+        size_t m_pendingBytes; // number of bytes written since the last flush
+        bool m_periodicFlush; // whether the output is registered for periodic flushes
+};
 
 }
 
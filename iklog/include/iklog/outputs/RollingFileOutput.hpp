@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, 2023, InternationalKoder
+    Copyright (C) 2019, 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -22,8 +22,10 @@
 
 #include "Output.hpp"
 #include "iklog/files/FileSize.hpp"
+#include "iklog/files/RollingFileNames.hpp"
 #include <ikgen/Result.hpp>
 #include <fstream>
+#include <future>
 #include <string>
 #include <assert.h>
 
@@ -38,6 +40,13 @@ namespace iklog
  * - File "myfile.log.0" is renamed to "myfile.log.1"
  * - A new empty file "myfile.log.0" is created, and new logs will be written in this one
  * When the maximum number of files is reached, the oldest file is removed to save disk space
+ *
+ * The logging thread does not wait for the rolling: the new file is opened in advance, as "myfile.log.next",
+ * and when the maximum size is reached the output only switches to it. Closing the previous file, renaming and removing
+ * the files, then opening the following new file are done by a background thread.
+ * If the background thread has not finished the previous rolling yet, the current file keeps growing until it has.
+ * On Windows, where open files cannot be renamed, the rolling is done by the logging thread instead:
+ * the current file is closed, the files are renamed, then the new file is opened.
  */
 class RollingFileOutput : public Output
 {
@@ -103,16 +112,34 @@ class RollingFileOutput : public Output
         IKLOG_EXPORT virtual ~RollingFileOutput();
 
         /*!
-         * \brief Writes the given message to the current file in the rolling system
-         * \param message The message to write
-         * \return The stream that was used to write the message
+         * \brief Sets whether the rolled files are compressed, by the background thread (see iklog::lz)
+         *
+         * A rolled file is compressed when it becomes the file with index 1, it is then named like "myfile.log.1.lz".
+         * The files remain compressed while they are rolled. Disabled by default
+         * \param compress True to compress the rolled files
          */
-        IKLOG_EXPORT virtual std::ostream& write(const std::string& message);
+        IKLOG_EXPORT void setRolledFilesCompression(bool compress);
 
-    private:
+        /*!
+         * \brief Tells whether the rolled files are compressed
+         * \return True if the rolled files are compressed
+         */
+        IKLOG_EXPORT bool isCompressingRolledFiles();
 
-        static constexpr char SEPARATOR = '.'; // separator that will go between the file name and the rolling index
+    protected:
 
+        /*!
+         * \brief Writes the given data to the current file in the rolling system
+         * \param data The data to write
+         */
+        IKLOG_EXPORT virtual void doWrite(std::string_view data) override;
+
+        /*!
+         * \brief Flushes the current file
+         */
+        IKLOG_EXPORT virtual void doFlush() override;
+
+    private:
 
         /*!
          * \brief Constructor
@@ -124,41 +151,55 @@ class RollingFileOutput : public Output
         RollingFileOutput(const std::string& baseFilename, unsigned int maxRollingFiles,
                           const FileSize<MULTIPLIER>& maxFileSize) :
             iklog::Output(),
-            m_maxRoll(maxRollingFiles - 1),
+            m_nextFileInUse(false),
+            m_compressRolledFiles(false),
             m_maxFileSize(maxFileSize.getValueInBytes()),
             m_fileSizeCache(0),
             m_cacheValidityThreshold(m_maxFileSize / 2),
-            m_baseFilenameSep(baseFilename + SEPARATOR),
-            m_firstRollingFileName(m_baseFilenameSep + '0'),
-            m_lastRollingFileName(m_baseFilenameSep + std::to_string(m_maxRoll))
+            m_fileNames(baseFilename, maxRollingFiles)
         {
             assert(m_maxFileSize > 0);
             assert(maxRollingFiles > 0);
-            m_file.open(m_firstRollingFileName, std::ios::out | std::ios::app);
-            if(!m_file.is_open())
-                throw std::runtime_error("Failed to open file '" + m_firstRollingFileName + "' in write mode");
+            open();
         }
 
 
         /*!
-         * \brief Rolls the files
+         * \brief Opens the first file and the next file of the rolling system, throws std::runtime_error on failure
+         */
+        void open();
+
+        /*!
+         * \brief Switches to the next file, and lets the background thread roll the files
          *
          * File number 3 becomes file number 4, file number 2 becomes file number 3, etc.
-         * File number 0 is a new file
+         * File number 0 is the file we switched to
          */
         void roll();
 
+        /*!
+         * \brief Lets the background thread close the previous file, roll the files if needed and open a new next file
+         */
+        void prepareNextFile();
+
+        /*!
+         * \brief Tells whether the next file is ready to be used, prepares it again if its preparation failed
+         * \return True if the output can switch to the next file
+         */
+        bool isNextFileReady();
+
 
         std::ofstream m_file; // current file we write to
-        const unsigned int m_maxRoll; // maximum number of files in the rolling system
+        std::ofstream m_nextFile; // file opened in advance to switch to when rolling, then previous file until it is closed
+        std::future<void> m_nextFilePreparation; // completion of the background preparation of the next file
+        bool m_nextFileInUse; // whether we write to the next file, which is not renamed yet
+        bool m_compressRolledFiles; // whether the rolled files are compressed
         const uintmax_t m_maxFileSize; // maximum file size after which a rolling is performed
 
         uintmax_t m_fileSizeCache; // estimated file size, to avoid reading the file system at each writing operation
         uintmax_t m_cacheValidityThreshold; // estimated file size at which the cache is invalidated and the actual file size is read again
 
-        const std::string m_baseFilenameSep; // base file name + the separator character
-        const std::string m_firstRollingFileName; // actual file name of the first file (the one we write to)
-        const std::string m_lastRollingFileName; // actual file name of the last file (the next one to be removed)
+        const internal::RollingFileNames m_fileNames; // names of the files in the rolling system
 };
 
 }
@@ -0,0 +1,174 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_SHARDED_OUTPUT_HPP
+#define IKLOG_SHARDED_OUTPUT_HPP
+
+#include "Output.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace iklog
+{
+
+/*!
+ * \brief Output letting several threads log concurrently without contending on a single lock
+ *
+ * Each thread writing to a ShardedOutput copies its formatted messages into its own buffer (shard).
+ * A dedicated thread regularly drains all the shards, merges their messages by timestamp and writes them
+ * to the wrapped output, which is then only used by this thread.
+ * Messages drained together are written in timestamp order, a message may only come before an older one
+ * if it has been logged just before the previous drain and the older one just after.
+ *
+ * When the shard of a thread is full, the thread waits for the next drain.
+ * The wrapped output receives messages with their level and clock time, but without log name nor text:
+ * the formatted message is given as data. Its flush policy applies as usual.
+ */
+class ShardedOutput : public Output
+{
+    public:
+
+        static constexpr size_t DEFAULT_SHARD_CAPACITY = 64 * 1024; //! default size of the buffer of each thread, in bytes
+        static constexpr std::chrono::milliseconds DEFAULT_DRAIN_INTERVAL{10}; //! default maximum time between two drains
+
+        /*!
+         * \brief Constructor
+         * \param output The output to write the merged messages to, must outlive the ShardedOutput
+         * \param shardCapacity The size of the buffer of each thread in bytes, the thread waits for a drain when it is full
+         * \param drainInterval The maximum time between two drains of the buffers
+         */
+        IKLOG_EXPORT ShardedOutput(Output& output, size_t shardCapacity = DEFAULT_SHARD_CAPACITY,
+                                   std::chrono::milliseconds drainInterval = DEFAULT_DRAIN_INTERVAL);
+
+        /*!
+         * \brief Destructor, writes the remaining messages then stops the drain thread
+         */
+        IKLOG_EXPORT virtual ~ShardedOutput();
+
+        /*!
+         * \brief Copies a formatted message to the buffer of the calling thread, without locking the output
+         * \param message The message that has been formatted
+         * \param formatted The formatted message, including its line ending
+         */
+        IKLOG_EXPORT virtual void write(const Message& message, std::string_view formatted) override;
+
+        /*!
+         * \brief Drains the buffers of all the threads to the wrapped output, then flushes it
+         */
+        IKLOG_EXPORT virtual void flush() override;
+
+    protected:
+
+        /*!
+         * \brief Copies data to the buffer of the calling thread, as a message logged now in the lowest level
+         * \param data The data to write
+         */
+        IKLOG_EXPORT virtual void doWrite(std::string_view data) override;
+
+        /*!
+         * \brief Drains the buffers of all the threads to the wrapped output
+         */
+        IKLOG_EXPORT virtual void doFlush() override;
+
+    private:
+
+        /*!
+         * \brief Position of a message in a shard
+         */
+        struct Entry
+        {
+            Message::TimePoint clockTime;
+            Level level;
+            size_t offset;
+            size_t length;
+        };
+
+        /*!
+         * \brief Buffer of a thread
+         */
+        struct Shard
+        {
+            std::mutex mutex; // protects the data and entries, only contended when draining
+            std::condition_variable drained; // wakes the thread up when it waits for a drain
+            std::string data; // formatted messages
+            std::vector<Entry> entries; // messages in data
+            std::string drainingData; // data being written by the drain thread
+            std::vector<Entry> drainingEntries; // entries being written by the drain thread
+            std::atomic<bool> abandoned = false; // whether the thread has exited, or the output has been destroyed
+        };
+
+        /*!
+         * \brief Shards of the calling thread, for all the ShardedOutput instances it wrote to
+         */
+        struct ThreadShards
+        {
+            ~ThreadShards();
+
+            std::vector<std::pair<uint64_t, std::shared_ptr<Shard>>> shards; // shards by identifier of output
+        };
+
+
+        /*!
+         * \brief Gives the shard of the calling thread, creating it on the first call
+         * \return The shard of the calling thread
+         */
+        Shard& getThreadShard();
+
+        /*!
+         * \brief Copies a message to the shard of the calling thread
+         * \param clockTime The time of the message
+         * \param level The level of the message
+         * \param formatted The formatted message
+         */
+        void append(const Message::TimePoint& clockTime, Level level, std::string_view formatted);
+
+        /*!
+         * \brief Writes the messages of all the shards to the wrapped output, merged by timestamp
+         */
+        void drain();
+
+        /*!
+         * \brief Runs the drain thread
+         */
+        void run();
+
+
+        Output& m_output;
+        const uint64_t m_id; // identifier of this instance, to find its shard in the shards of the threads
+        const size_t m_shardCapacity;
+        const std::chrono::milliseconds m_drainInterval;
+
+        std::mutex m_shardsMutex; // protects the list of shards, held while draining
+        std::vector<std::shared_ptr<Shard>> m_shards; // shards of all the threads
+
+        std::mutex m_threadMutex; // protects the running state of the drain thread
+        std::condition_variable m_condVar; // wakes the drain thread up when a shard is full or the output is destroyed
+        bool m_running;
+        std::thread m_thread;
+};
+
+}
+
+#endif // IKLOG_SHARDED_OUTPUT_HPP
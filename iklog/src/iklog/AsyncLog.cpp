@@ -0,0 +1,143 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/AsyncLog.hpp"
+
+namespace iklog
+{
+
+AsyncLog::AsyncLog(const std::string& name, int levels, Output& output, const Formatter& formatter,
+                   size_t queueCapacity, OverflowPolicy overflowPolicy) :
+    Log(name, levels, output, formatter),
+    m_queue(queueCapacity),
+    m_overflowPolicy(overflowPolicy),
+    m_running(true),
+    m_writerSleeping(false),
+    m_writerThread(&AsyncLog::run, this)
+{}
+
+AsyncLog::~AsyncLog()
+{
+    stopRateLimiterSummaries();
+
+    m_running = false;
+    m_wakeUp.notify_one();
+    m_writerThread.join();
+}
+
+void AsyncLog::doLog(Level level, std::string_view message, std::span<const Field> fields) const
+{
+    const Message::TimePoint clockTime = getClock().now();
+    const auto fillRecord = [level, &clockTime, &message, fields](Record& record)
+    {
+        record.level = level;
+        record.clockTime = clockTime;
+        record.message.assign(message);
+        copyFields(fields, record);
+
+        const ThreadContext& threadContext = ThreadContext::current();
+        if(record.threadContext.getVersion() != threadContext.getVersion())
+            record.threadContext = threadContext;
+    };
+
+    while(!m_queue.tryPush(fillRecord))
+    {
+        if(m_overflowPolicy == OverflowPolicy::DROP)
+        {
+            m_metrics.countDropped();
+            return;
+        }
+
+        m_wakeUp.notify_one();
+        std::this_thread::yield();
+    }
+
+    if(m_writerSleeping.load(std::memory_order_relaxed))
+        m_wakeUp.notify_one();
+}
+
+void AsyncLog::copyFields(std::span<const Field> fields, Record& record)
+{
+    record.fields.clear();
+    record.fieldStrings.clear();
+
+    // the strings are all copied before the fields refer to them, as appending may move them
+    for(const Field& field : fields)
+    {
+        record.fieldStrings += field.getKey();
+        if(const auto* value = std::get_if<std::string_view>(&field.getValue()))
+            record.fieldStrings += *value;
+    }
+
+    const std::string_view strings = record.fieldStrings;
+    size_t offset = 0;
+
+    for(const Field& field : fields)
+    {
+        const std::string_view key = strings.substr(offset, field.getKey().size());
+        offset += key.size();
+
+        if(const auto* value = std::get_if<std::string_view>(&field.getValue()))
+        {
+            record.fields.emplace_back(key, strings.substr(offset, value->size()));
+            offset += value->size();
+        }
+        else
+            record.fields.emplace_back(key, field.getValue());
+    }
+}
+
+void AsyncLog::run()
+{
+    const auto writeRecord = [this](const Record& record)
+    {
+        write(Message(getName(), record.level, record.message, record.clockTime - getStartTime(), record.clockTime,
+                      record.fields, record.threadContext));
+    };
+
+    unsigned int idlePolls = 0;
+
+    while(true)
+    {
+        if(m_queue.tryPop(writeRecord))
+        {
+            idlePolls = 0;
+            continue;
+        }
+
+        // the queue is empty: all messages have been written and we can stop
+        if(!m_running)
+            break;
+
+        if(++idlePolls < IDLE_SPIN_COUNT)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // nothing to write for a while, sleep until a producer notifies us
+        std::unique_lock<std::mutex> lock(m_wakeUpMutex);
+        m_writerSleeping = true;
+        m_wakeUp.wait_for(lock, IDLE_WAIT_TIMEOUT);
+        m_writerSleeping = false;
+        idlePolls = 0;
+    }
+}
+
+}
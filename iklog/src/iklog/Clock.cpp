@@ -0,0 +1,151 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/Clock.hpp"
+#include <ctime>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define IKLOG_HAS_TIME_STAMP_COUNTER
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+namespace iklog
+{
+
+namespace
+{
+    Clock::TimePoint systemNow()
+    {
+        return std::chrono::system_clock::now();
+    }
+
+#ifdef CLOCK_REALTIME_COARSE
+    Clock::TimePoint realtimeCoarseNow()
+    {
+        struct timespec time;
+        clock_gettime(CLOCK_REALTIME_COARSE, &time);
+
+        return Clock::TimePoint(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                                    std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec)));
+    }
+#endif
+
+#ifdef IKLOG_HAS_TIME_STAMP_COUNTER
+    constexpr std::chrono::milliseconds CALIBRATION_DURATION{10}; // time during which the counter rate is measured
+    constexpr std::chrono::seconds REFERENCE_INTERVAL{1}; // time after which a thread reads the system clock again
+
+    /*!
+     * \brief Rate of the time stamp counter
+     */
+    struct TimeStampCounterRate
+    {
+        double nanosecondsPerTick;
+        uint64_t referenceIntervalTicks; // number of ticks in REFERENCE_INTERVAL
+    };
+
+    /*!
+     * \brief Gives the rate of the time stamp counter, measured against the steady clock the first time it is called
+     * \return The rate of the counter
+     */
+    const TimeStampCounterRate& getTimeStampCounterRate()
+    {
+        static const TimeStampCounterRate rate = []()
+        {
+            const auto start = std::chrono::steady_clock::now();
+            const uint64_t startTicks = __rdtsc();
+
+            auto end = start;
+            while(end - start < CALIBRATION_DURATION)
+                end = std::chrono::steady_clock::now();
+
+            const uint64_t endTicks = __rdtsc();
+            const double nanoseconds = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            const double nanosecondsPerTick = nanoseconds / static_cast<double>(endTicks - startTicks);
+            const double referenceNanoseconds = static_cast<double>(std::chrono::nanoseconds(REFERENCE_INTERVAL).count());
+
+            return TimeStampCounterRate{ nanosecondsPerTick, static_cast<uint64_t>(referenceNanoseconds / nanosecondsPerTick) };
+        }();
+
+        return rate;
+    }
+
+    Clock::TimePoint timeStampCounterNow()
+    {
+        // system time read by this thread, and the counter value at that time
+        thread_local Clock::TimePoint referenceTime;
+        thread_local uint64_t referenceTicks = 0;
+        thread_local bool hasReference = false;
+
+        const TimeStampCounterRate& rate = getTimeStampCounterRate();
+        const uint64_t ticks = __rdtsc();
+
+        if(!hasReference || ticks - referenceTicks >= rate.referenceIntervalTicks)
+        {
+            referenceTime = std::chrono::system_clock::now();
+            referenceTicks = __rdtsc();
+            hasReference = true;
+            return referenceTime;
+        }
+
+        const auto elapsed = std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(ticks - referenceTicks) * rate.nanosecondsPerTick));
+        return referenceTime + std::chrono::duration_cast<std::chrono::system_clock::duration>(elapsed);
+    }
+#endif
+}
+
+Clock Clock::system()
+{
+    return Clock(&systemNow);
+}
+
+Clock Clock::realtimeCoarse()
+{
+#ifdef CLOCK_REALTIME_COARSE
+    return Clock(&realtimeCoarseNow);
+#else
+    return system();
+#endif
+}
+
+Clock Clock::timeStampCounter()
+{
+#ifdef IKLOG_HAS_TIME_STAMP_COUNTER
+    if(isTimeStampCounterAvailable())
+    {
+        getTimeStampCounterRate();
+        return Clock(&timeStampCounterNow);
+    }
+#endif
+
+    return system();
+}
+
+bool Clock::isTimeStampCounterAvailable()
+{
+#ifdef IKLOG_HAS_TIME_STAMP_COUNTER
+    // the invariant TSC flag is bit 8 of EDX in the advanced power management leaf
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) != 0 && (edx & (1u << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+}
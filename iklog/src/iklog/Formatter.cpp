@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, 2023, InternationalKoder
+    Copyright (C) 2019, 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -18,49 +18,162 @@
 */
 
 #include "iklog/Formatter.hpp"
+#include "TextEscaping.hpp"
+#include <algorithm>
 #include <ctime>
 #include <cassert>
+#include <charconv>
 #include <iostream>
 
 namespace iklog
 {
 
-typedef std::string(*getFunc)(const Message&);
+typedef void(*appendFunc)(const Message&, std::string&);
 
 
-const std::map<char, getFunc> Formatter::FORMAT_MAPPING
+const std::map<char, appendFunc> Formatter::FORMAT_MAPPING
 {
-    {'L', &Formatter::getLogName},
-    {'l', &Formatter::getLevel},
-    {'p', &Formatter::getLevelPretty},
-    {'m', &Formatter::getMessage},
-    {'d', &Formatter::getProgramDuration},
-    {'t', &Formatter::getClockTime}
+    {'L', &Formatter::appendLogName},
+    {'l', &Formatter::appendLevel},
+    {'p', &Formatter::appendLevelPretty},
+    {'m', &Formatter::appendMessage},
+    {'d', &Formatter::appendProgramDuration},
+    {'t', &Formatter::appendClockTime},
+    {'T', &Formatter::appendClockTimeMillis},
+    {'U', &Formatter::appendClockTimeMicros},
+    {'F', &Formatter::appendFields},
+    {'i', &Formatter::appendThreadId},
+    {'n', &Formatter::appendThreadName},
+    {'X', &Formatter::appendThreadEntries}
 };
 
 
 Formatter::Formatter(const std::string& format) :
-    m_format(format)
-{}
+    m_style(Style::TEXT),
+    m_format(format),
+    m_literalLength(0)
+{
+    compile();
+}
+
+
+Formatter::Formatter(Style style) :
+    Formatter()
+{
+    m_style = style;
+}
 
 
 std::string Formatter::format(const Message& message) const
 {
-    std::string formatted(m_format);
+    std::string formatted;
+    formatted.reserve(m_literalLength + message.getMessage().size() + FIELDS_RESERVE);
+    format(message, formatted);
+
+    return formatted;
+}
+
+
+void Formatter::format(const Message& message, std::string& output) const
+{
+    if(m_style == Style::JSON)
+    {
+        appendJson(message, output);
+        return;
+    }
+
+    if(m_style == Style::LOGFMT)
+    {
+        appendLogfmt(message, output);
+        return;
+    }
+
+    for(const Segment& segment : m_segments)
+    {
+        if(segment.append == nullptr)
+            output.append(m_format, segment.literalStart, segment.literalLength);
+        else
+            segment.append(message, output);
+    }
+}
+
+
+void Formatter::setFormat(const std::string& format)
+{
+    m_style = Style::TEXT;
+    m_format = format;
+    compile();
+}
+
 
-    for(std::string::size_type i = 0 ; i < formatted.size() - 1 ; i++)
+void Formatter::compile()
+{
+    m_segments.clear();
+    m_literalLength = 0;
+
+    std::string::size_type literalStart = 0;
+    const auto addLiteral = [this, &literalStart](std::string::size_type literalEnd)
     {
-        if(formatted[i] == '%')
+        if(literalEnd > literalStart)
         {
-            formatted.replace(i, 2, (FORMAT_MAPPING.at(formatted[i+1]))(message));
+            m_segments.push_back({nullptr, literalStart, literalEnd - literalStart});
+            m_literalLength += literalEnd - literalStart;
         }
+    };
+
+    for(std::string::size_type i = 0 ; i + 1 < m_format.size() ; i++)
+    {
+        if(m_format[i] != '%')
+            continue;
+
+        const auto field = FORMAT_MAPPING.find(m_format[i + 1]);
+        if(field == FORMAT_MAPPING.end())
+            continue;
+
+        addLiteral(i);
+        m_segments.push_back({field->second, 0, 0});
+
+        i++;
+        literalStart = i + 1;
     }
 
-    return formatted;
+    addLiteral(m_format.size());
 }
 
 
 std::string Formatter::getLevel(const Message& message)
+{
+    std::string level;
+    appendLevel(message, level);
+    return level;
+}
+
+
+std::string Formatter::getLevelPretty(const Message& message)
+{
+    std::string level;
+    appendLevelPretty(message, level);
+    return level;
+}
+
+
+std::string Formatter::getProgramDuration(const Message& message)
+{
+    std::string duration;
+    appendProgramDuration(message, duration);
+    return duration;
+}
+
+
+std::string Formatter::getClockTime(const Message& message)
+{
+    std::string time;
+    appendClockTime(message, time);
+    return time;
+}
+
+
+void Formatter::appendLevel(const Message& message, std::string& output)
 {
     const Level& level = message.getLevel();
     assert(level == Level::INFO || level == Level::DEBUG || level == Level::WARNING || level == Level::ERROR);
@@ -68,20 +181,22 @@ std::string Formatter::getLevel(const Message& message)
     switch(level)
     {
         case Level::INFO:
-            return "INFO";
+            output += "INFO";
+            break;
         case Level::DEBUG:
-            return "DEBUG";
+            output += "DEBUG";
+            break;
         case Level::WARNING:
-            return "WARNING";
+            output += "WARNING";
+            break;
         case Level::ERROR:
-            return "ERROR";
+            output += "ERROR";
+            break;
     }
-
-    return "";
 }
 
 
-std::string Formatter::getLevelPretty(const Message& message)
+void Formatter::appendLevelPretty(const Message& message, std::string& output)
 {
     const Level& level = message.getLevel();
     assert(level == Level::INFO || level == Level::DEBUG || level == Level::WARNING || level == Level::ERROR);
@@ -89,70 +204,231 @@ std::string Formatter::getLevelPretty(const Message& message)
     switch(level)
     {
         case Level::INFO:
-            return "INFO";
+            output += "INFO";
+            return;
         case Level::DEBUG:
-            return "DBUG";
+            output += "DBUG";
+            return;
         case Level::WARNING:
-            return "WARN";
+            output += "WARN";
+            return;
         case Level::ERROR:
-            return "ERR ";
+            output += "ERR ";
+            return;
     }
 
-    return "    ";
+    output += "    ";
 }
 
 
-std::string Formatter::getProgramDuration(const Message& message)
+void Formatter::appendProgramDuration(const Message& message, std::string& output)
 {
-    const Message::Duration& DURATION = message.getProgramDuration();
+    // a clock going backward can give a message a negative duration
+    const Message::Duration DURATION = std::max(message.getProgramDuration(), Message::Duration::zero());
 
     const auto HOURS = std::chrono::duration_cast<std::chrono::hours>(DURATION).count();
     const auto MINUTES = std::chrono::duration_cast<std::chrono::minutes>(DURATION).count() % 60;
     const auto SECONDS = std::chrono::duration_cast<std::chrono::seconds>(DURATION).count() % 60;
 
-    std::string duration = std::to_string(HOURS) + ":";
-    if(MINUTES < 10)
-        duration += "0";
-    duration += std::to_string(MINUTES) + ":";
-    if(SECONDS < 10)
-        duration += "0";
-    duration += std::to_string(SECONDS);
+    char buff[32];
+    char* end = std::to_chars(buff, buff + sizeof(buff) - 6, HOURS).ptr;
+
+    *end++ = ':';
+    *end++ = static_cast<char>('0' + MINUTES / 10);
+    *end++ = static_cast<char>('0' + MINUTES % 10);
+    *end++ = ':';
+    *end++ = static_cast<char>('0' + SECONDS / 10);
+    *end++ = static_cast<char>('0' + SECONDS % 10);
 
-    return duration;
+    output.append(buff, end);
 }
 
 
-std::string Formatter::getClockTime(const Message& message)
+void Formatter::appendClockTime(const Message& message, std::string& output)
+{
+    appendClockSeconds(message, output);
+}
+
+
+void Formatter::appendClockTimeMillis(const Message& message, std::string& output)
 {
-    const Message::TimePoint& TIME = message.getClockTime();
-    std::time_t time = std::chrono::system_clock::to_time_t(TIME);
-
-    struct tm tm = {
-        .tm_sec = 0,
-        .tm_min = 0,
-        .tm_hour = 0,
-        .tm_mday = 1,
-        .tm_mon = 0,
-        .tm_year = 0,
-        .tm_wday = 0,
-        .tm_yday = 0,
-        .tm_isdst = -1,
+    appendClockSeconds(message, output);
+    appendClockSubSeconds<std::chrono::milliseconds>(message, output);
+}
+
+
+void Formatter::appendClockTimeMicros(const Message& message, std::string& output)
+{
+    appendClockSeconds(message, output);
+    appendClockSubSeconds<std::chrono::microseconds>(message, output);
+}
+
+
+void Formatter::appendFields(const Message& message, std::string& output)
+{
+    internal::appendLogfmtFields(output, message.getFields());
+}
+
+
+void Formatter::appendJson(const Message& message, std::string& output)
+{
+    output += "{\"time\":\"";
+    appendUtcTime(message, output);
+    output += "\",\"level\":\"";
+    appendLevel(message, output);
+    output += "\",\"log\":";
+    internal::appendJsonString(output, message.getLogName());
+
+    // the identifier is made of digits, so it is written as a number
+    const ThreadContext& threadContext = message.getThreadContext();
+    if(!threadContext.getThreadId().empty())
+    {
+        output += ",\"thread\":";
+        output += threadContext.getThreadId();
+    }
+
+    if(!threadContext.getThreadName().empty())
+    {
+        output += ",\"threadName\":";
+        internal::appendJsonString(output, threadContext.getThreadName());
+    }
+
+    output += ",\"msg\":";
+    internal::appendJsonString(output, message.getMessage());
+    output += threadContext.getJsonEntries();
+    internal::appendJsonFields(output, message.getFields());
+    output += '}';
+}
+
+
+void Formatter::appendLogfmt(const Message& message, std::string& output)
+{
+    output += "time=";
+    appendUtcTime(message, output);
+    output += " level=";
+    appendLevel(message, output);
+    output += " log=";
+    internal::appendLogfmtString(output, message.getLogName());
+
+    const ThreadContext& threadContext = message.getThreadContext();
+    if(!threadContext.getThreadId().empty())
+    {
+        output += " thread=";
+        output += threadContext.getThreadId();
+    }
+
+    if(!threadContext.getThreadName().empty())
+    {
+        output += " threadName=";
+        internal::appendLogfmtString(output, threadContext.getThreadName());
+    }
+
+    output += " msg=";
+    internal::appendLogfmtString(output, message.getMessage());
+
+    if(!threadContext.getLogfmtEntries().empty())
+    {
+        output += ' ';
+        output += threadContext.getLogfmtEntries();
+    }
+
+    if(!message.getFields().empty())
+    {
+        output += ' ';
+        internal::appendLogfmtFields(output, message.getFields());
+    }
+}
+
+
+void Formatter::appendUtcTime(const Message& message, std::string& output)
+{
+    // rendering of the last second formatted by this thread
+    thread_local std::time_t cachedTime = -1;
+    thread_local char cachedText[32];
+    thread_local size_t cachedLength = 0;
+
+    const std::time_t time = std::chrono::system_clock::to_time_t(message.getClockTime());
+
+    if(time != cachedTime)
+    {
+        struct tm tm = {};
+
+#ifdef _WIN32
+        gmtime_s(&tm, &time);
+#elif defined __unix__
+        gmtime_r(&time, &tm);
+#endif
+
+        cachedLength = strftime(cachedText, sizeof(cachedText), "%Y-%m-%dT%H:%M:%S", &tm);
+        cachedTime = time;
+    }
+
+    output.append(cachedText, cachedLength);
+    appendClockSubSeconds<std::chrono::microseconds>(message, output);
+    output += 'Z';
+}
+
+
+void Formatter::appendClockSeconds(const Message& message, std::string& output)
+{
+    // rendering of the last second formatted by this thread
+    thread_local std::time_t cachedTime = -1;
+    thread_local char cachedText[32];
+    thread_local size_t cachedLength = 0;
+
+    const std::time_t time = std::chrono::system_clock::to_time_t(message.getClockTime());
+
+    if(time != cachedTime)
+    {
+        struct tm tm = {
+            .tm_sec = 0,
+            .tm_min = 0,
+            .tm_hour = 0,
+            .tm_mday = 1,
+            .tm_mon = 0,
+            .tm_year = 0,
+            .tm_wday = 0,
+            .tm_yday = 0,
+            .tm_isdst = -1,
 #ifdef _GNU_SOURCE
-        .tm_gmtoff = 0,
-        .tm_zone = nullptr,
+            .tm_gmtoff = 0,
+            .tm_zone = nullptr,
 #endif
-    };
+        };
 
 #ifdef _WIN32
-    localtime_s(&tm, &time);
+        localtime_s(&tm, &time);
 #elif defined __unix__
-    localtime_r(&time, &tm);
+        localtime_r(&time, &tm);
 #endif
 
-    char buff[32];
-    strftime(buff, 32, "%a, %Y-%m-%d %H:%M:%S", &tm);
+        cachedLength = strftime(cachedText, sizeof(cachedText), "%a, %Y-%m-%d %H:%M:%S", &tm);
+        cachedTime = time;
+    }
+
+    output.append(cachedText, cachedLength);
+}
+
+
+template<typename D>
+void Formatter::appendClockSubSeconds(const Message& message, std::string& output)
+{
+    constexpr unsigned int DIGITS = D::period::den == 1000 ? 3 : 6;
+    static_assert(D::period::den == 1000 || D::period::den == 1000000, "Only milliseconds and microseconds are supported");
+
+    const auto sinceEpoch = message.getClockTime().time_since_epoch();
+    auto fraction = static_cast<uint32_t>((std::chrono::duration_cast<D>(sinceEpoch) -
+                                           std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch)).count());
+
+    char buff[DIGITS + 1];
+    buff[0] = '.';
+    for(unsigned int i = DIGITS ; i > 0 ; i--)
+    {
+        buff[i] = static_cast<char>('0' + fraction % 10);
+        fraction /= 10;
+    }
 
-    return std::string(buff);
+    output.append(buff, DIGITS + 1);
 }
 
 }
@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, 2020, InternationalKoder
+    Copyright (C) 2019, 2020, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -20,46 +20,182 @@
 #include "iklog/Log.hpp"
 #include "iklog/Message.hpp"
 #include "iklog/NullLog.hpp"
+#include "iklog/LogHandle.hpp"
+#include "LogRegistry.hpp"
+#include "outputs/FlushTicker.hpp"
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace iklog
 {
+    namespace
+    {
+        constexpr Level ALL_LEVELS[] = { Level::INFO, Level::DEBUG, Level::WARNING, Level::ERROR };
+    }
+
     OstreamWrapper Log::DEFAULT_OUTPUT(std::cout);
 
     Log::Log(const std::string& name, int levels, Output& output, const Formatter& formatter) :
         m_name(name),
+        m_registrySlot(&internal::LogRegistry::getInstance().getSlot(name)),
+        m_rateLimiters{},
+        m_summariesScheduled(false),
         m_levels(levels),
-        m_startTime(std::chrono::system_clock::now()),
+        m_clock(Clock::system()),
+        m_startTime(m_clock.now()),
         m_formatter(formatter)
     {
-        getLogsList()[name] = this;
+        setOutput(output);
 
-        m_outputs[Level::INFO]    = &output;
-        m_outputs[Level::DEBUG]   = &output;
-        m_outputs[Level::WARNING] = &output;
-        m_outputs[Level::ERROR]   = &output;
+        m_registrySlot->log.store(this, std::memory_order_release);
     }
 
     Log::~Log()
-    {}
+    {
+        stopRateLimiterSummaries();
+
+        // unregister, unless another Log has replaced this one
+        Log* registered = this;
+        m_registrySlot->log.compare_exchange_strong(registered, nullptr, std::memory_order_acq_rel);
+    }
+
+    void Log::log(Level level, std::string_view message) const
+    {
+        if(isLevelEnabled(level) && isAllowedByRateLimiter(level))
+            logAdmitted(level, message);
+    }
+
+    void Log::doLog(Level level, std::string_view message, std::span<const Field> fields) const
+    {
+        // a single reading of the clock gives both the clock time and the duration of the message
+        const Message::TimePoint now = m_clock.now();
+
+        write(Message(m_name, level, message, now - m_startTime, now, fields));
+    }
 
-    void Log::log(Level level, const std::string& message) const
+    void Log::write(const Message& message) const
     {
-        if(isLevelEnabled(level))
+        // reuse the same buffer for all the messages of the thread, to avoid an allocation at each message
+        thread_local std::string formatted;
+        formatted.clear();
+        m_formatter.format(message, formatted);
+        formatted += '\n';
+
+        for(Output* output : m_outputs[getLevelIndex(message.getLevel())])
+            output->write(message, formatted);
+    }
+
+    void Log::addOutput(Output& output, int levels)
+    {
+        for(Level level : ALL_LEVELS)
         {
-            std::chrono::steady_clock::duration diff = std::chrono::system_clock::now() - m_startTime;
+            if((levels & level) != 0)
+                m_outputs[getLevelIndex(level)].push_back(&output);
+        }
+    }
+
+    void Log::removeOutput(Output& output)
+    {
+        for(std::vector<Output*>& levelOutputs : m_outputs)
+            std::erase(levelOutputs, &output);
+    }
 
-            Message logMessage(m_name, level, message, diff, std::chrono::system_clock::now());
-            *m_outputs.at(level) << m_formatter.format(logMessage) << std::endl;
+    void Log::setClock(const Clock& clock)
+    {
+        // the durations of the messages are computed with the new clock only, as two clocks may differ by an offset
+        const auto elapsed = m_clock.now() - m_startTime;
+        m_clock = clock;
+        m_startTime = m_clock.now() - elapsed;
+    }
+
+    void Log::setRateLimiter(RateLimiter& limiter, int levels)
+    {
+        // the background thread reads the limiters, they are not changed while it may write the summaries
+        unscheduleSummaries();
+
+        for(Level level : ALL_LEVELS)
+        {
+            if((levels & level) != 0)
+                m_rateLimiters[getLevelIndex(level)] = &limiter;
+        }
+
+        scheduleSummaries();
+    }
+
+    void Log::removeRateLimiter(int levels)
+    {
+        unscheduleSummaries();
+
+        for(Level level : ALL_LEVELS)
+        {
+            if((levels & level) != 0)
+                m_rateLimiters[getLevelIndex(level)] = nullptr;
+        }
+
+        scheduleSummaries();
+    }
+
+    void Log::stopRateLimiterSummaries()
+    {
+        if(!m_summariesScheduled)
+            return;
+
+        unscheduleSummaries();
+        writeSummaries(true);
+    }
+
+    void Log::writeSuppressedSummary(Level level, uint64_t suppressedCount) const
+    {
+        doLog(level, std::to_string(suppressedCount) + " messages suppressed by rate limiting", {});
+    }
+
+    void Log::writeSummaries(bool remaining) const
+    {
+        for(Level level : ALL_LEVELS)
+        {
+            RateLimiter* const limiter = m_rateLimiters[getLevelIndex(level)];
+            if(limiter == nullptr || !isLevelEnabled(level))
+                continue;
+
+            const uint64_t suppressedCount = remaining ? limiter->takeRemainingSummary() : limiter->takeSummary();
+            if(suppressedCount != 0)
+                writeSuppressedSummary(level, suppressedCount);
+        }
+    }
+
+    void Log::scheduleSummaries()
+    {
+        std::chrono::milliseconds interval = std::chrono::milliseconds::max();
+        for(const RateLimiter* limiter : m_rateLimiters)
+        {
+            if(limiter != nullptr)
+                interval = std::min(interval, limiter->getSummaryInterval());
+        }
+
+        if(interval == std::chrono::milliseconds::max())
+            return;
+
+        // a null interval would keep the thread busy, the summaries are still written at most once per interval
+        interval = std::max(interval, std::chrono::milliseconds(1));
+        internal::FlushTicker::getInstance().add(this, [this]() { writeSummaries(false); }, interval);
+        m_summariesScheduled = true;
+    }
+
+    void Log::unscheduleSummaries()
+    {
+        if(m_summariesScheduled)
+        {
+            internal::FlushTicker::getInstance().remove(static_cast<const void*>(this));
+            m_summariesScheduled = false;
         }
     }
 
-    Log* Log::getLog(const std::string& name)
+    Log* Log::getLog(std::string_view name)
     {
-        auto it = getLogsList().find(name);
-        if(it != getLogsList().end())
-            return it->second;
-        else
-            return &NullLog::getInstance();
+        internal::LogSlot* const slot = internal::LogRegistry::getInstance().find(name);
+        Log* const log = slot != nullptr ? slot->log.load(std::memory_order_acquire) : nullptr;
+        return log != nullptr ? log : &NullLog::getInstance();
     }
 }
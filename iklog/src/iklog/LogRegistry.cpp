@@ -0,0 +1,101 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "LogRegistry.hpp"
+#include <thread>
+
+namespace iklog
+{
+    namespace internal
+    {
+        LogRegistry& LogRegistry::getInstance()
+        {
+            static LogRegistry* const logRegistry = new LogRegistry();
+            return *logRegistry;
+        }
+
+        LogRegistry::LogRegistry() :
+            m_snapshot(new Snapshot()),
+            m_epoch(0),
+            m_readers{0, 0}
+        {}
+
+        LogSlot* LogRegistry::find(std::string_view name) const
+        {
+            const unsigned int epoch = enterRead();
+            LogSlot* const slot = findInSnapshot(name);
+            leaveRead(epoch);
+            return slot;
+        }
+
+        LogSlot& LogRegistry::getSlot(std::string_view name)
+        {
+            if(LogSlot* const slot = find(name))
+                return *slot;
+
+            std::lock_guard<std::mutex> lock(m_writeMutex);
+
+            // the name may have been added meanwhile
+            if(LogSlot* const slot = findInSnapshot(name))
+                return *slot;
+
+            LogSlot& slot = m_slots.emplace_back();
+
+            const Snapshot* const previous = m_snapshot.load(std::memory_order_relaxed);
+            Snapshot* const next = new Snapshot(*previous);
+            next->emplace(std::string(name), &slot);
+            m_snapshot.store(next, std::memory_order_seq_cst);
+
+            // new readers now enter the other epoch, wait for the ones that may still read the previous snapshot
+            const unsigned int previousEpoch = m_epoch.fetch_add(1, std::memory_order_seq_cst);
+            while(m_readers[previousEpoch & 1].load(std::memory_order_seq_cst) != 0)
+                std::this_thread::yield();
+
+            delete previous;
+            return slot;
+        }
+
+        LogSlot* LogRegistry::findInSnapshot(std::string_view name) const
+        {
+            const Snapshot* const snapshot = m_snapshot.load(std::memory_order_seq_cst);
+            const auto it = snapshot->find(name);
+            return it != snapshot->end() ? it->second : nullptr;
+        }
+
+        unsigned int LogRegistry::enterRead() const
+        {
+            while(true)
+            {
+                const unsigned int epoch = m_epoch.load(std::memory_order_seq_cst);
+                m_readers[epoch & 1].fetch_add(1, std::memory_order_seq_cst);
+
+                // if a writer changed the epoch meanwhile, it may not wait for this reader
+                if(m_epoch.load(std::memory_order_seq_cst) == epoch)
+                    return epoch;
+
+                m_readers[epoch & 1].fetch_sub(1, std::memory_order_seq_cst);
+            }
+        }
+
+        void LogRegistry::leaveRead(unsigned int epoch) const
+        {
+            m_readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+        }
+    }
+}
@@ -0,0 +1,116 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_LOG_REGISTRY_HPP
+#define IKLOG_LOG_REGISTRY_HPP
+
+#include "iklog/LogHandle.hpp"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace iklog
+{
+    namespace internal
+    {
+        /*!
+         * \brief Registry of the Log instances by name
+         *
+         * Each name has a slot, created on the first registration or lookup of the name and never removed,
+         * holding the Log currently registered with the name.
+         * The names are looked up in an immutable snapshot of the registry, so readers never take a lock:
+         * adding a name copies the snapshot and publishes the copy. The previous snapshot is deleted
+         * once the readers that may still use it are done, which they signal with counters split in two epochs
+         */
+        class LogRegistry
+        {
+            public:
+
+                /*!
+                 * \brief Gives the singleton instance
+                 *
+                 * The instance is never destroyed, so that Log instances destroyed at exit can still unregister
+                 * \return The singleton instance
+                 */
+                static LogRegistry& getInstance();
+
+                /*!
+                 * \brief Gives the slot of a name, without taking any lock
+                 * \param name The name to look up
+                 * \return The slot of the name, or nullptr if the name is unknown
+                 */
+                LogSlot* find(std::string_view name) const;
+
+                /*!
+                 * \brief Gives the slot of a name, creating it if the name is unknown
+                 * \param name The name to look up
+                 * \return The slot of the name
+                 */
+                LogSlot& getSlot(std::string_view name);
+
+            private:
+
+                /*!
+                 * \brief Hash of the names, allowing to look up a std::string_view without building a std::string
+                 */
+                struct NameHash
+                {
+                    using is_transparent = void;
+
+                    inline size_t operator()(std::string_view name) const { return std::hash<std::string_view>()(name); }
+                };
+
+                using Snapshot = std::unordered_map<std::string, LogSlot*, NameHash, std::equal_to<>>;
+
+
+                LogRegistry();
+
+                /*!
+                 * \brief Looks a name up in the current snapshot, must be called by the thread holding the write mutex
+                 * or between enterRead and leaveRead
+                 */
+                LogSlot* findInSnapshot(std::string_view name) const;
+
+                /*!
+                 * \brief Declares the calling thread as a reader of the current snapshot
+                 * \return The epoch to give back to leaveRead
+                 */
+                unsigned int enterRead() const;
+
+                /*!
+                 * \brief Declares the calling thread does not use the snapshot anymore
+                 * \param epoch The epoch returned by enterRead
+                 */
+                void leaveRead(unsigned int epoch) const;
+
+
+                std::atomic<const Snapshot*> m_snapshot; // current snapshot, replaced when a name is added
+                std::atomic<unsigned int> m_epoch; // incremented each time a snapshot is replaced
+                mutable std::atomic<unsigned int> m_readers[2]; // number of readers in each epoch parity
+
+                std::mutex m_writeMutex; // serializes the additions of names
+                std::deque<LogSlot> m_slots; // slots of all the names, never removed so their addresses are stable
+        };
+    }
+}
+
+#endif // IKLOG_LOG_REGISTRY_HPP
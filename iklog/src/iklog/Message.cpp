@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, InternationalKoder
+    Copyright (C) 2019, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -21,12 +21,15 @@
 
 namespace iklog
 {
-    Message::Message(const std::string& logName, Level level, const std::string& message,
-                     const Duration& programDuration, const TimePoint& clockTime) :
+    Message::Message(std::string_view logName, Level level, std::string_view message,
+                     const Duration& programDuration, const TimePoint& clockTime,
+                     std::span<const Field> fields, const ThreadContext& threadContext) :
         m_logName(logName),
         m_level(level),
         m_message(message),
         m_programDuration(programDuration),
-        m_clockTime(clockTime)
+        m_clockTime(clockTime),
+        m_fields(fields),
+        m_threadContext(&threadContext)
     {}
 }
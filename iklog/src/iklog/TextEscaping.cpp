@@ -0,0 +1,238 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TextEscaping.hpp"
+#include "iklog/MessageFormat.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <variant>
+
+namespace iklog
+{
+    namespace internal
+    {
+        namespace
+        {
+            constexpr uint64_t BYTE_ONES = 0x0101010101010101ULL; // 1 in each byte of a word
+            constexpr uint64_t BYTE_HIGH_BITS = 0x8080808080808080ULL; // highest bit of each byte of a word
+            constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+            /*!
+             * \brief Tells whether a word contains a byte lower than a value
+             * \param word The 8 bytes to check
+             * \param value The value, at most 128
+             * \return Non-zero if a byte of the word is lower than the value
+             */
+            constexpr uint64_t hasByteLowerThan(uint64_t word, uint8_t value)
+            {
+                return (word - BYTE_ONES * value) & ~word & BYTE_HIGH_BITS;
+            }
+
+            /*!
+             * \brief Tells whether a word contains a byte equal to a value
+             * \param word The 8 bytes to check
+             * \param value The value to look for
+             * \return Non-zero if a byte of the word is equal to the value
+             */
+            constexpr uint64_t hasByte(uint64_t word, uint8_t value)
+            {
+                return hasByteLowerThan(word ^ (BYTE_ONES * value), 1);
+            }
+
+            // characters escaped in JSON strings and in quoted logfmt values
+            constexpr bool isEscaped(unsigned char character)
+            {
+                return character < 0x20 || character == '"' || character == '\\';
+            }
+
+            constexpr uint64_t hasEscaped(uint64_t word)
+            {
+                return hasByteLowerThan(word, 0x20) | hasByte(word, '"') | hasByte(word, '\\');
+            }
+
+            // characters making a logfmt value quoted, or replaced in a logfmt key
+            constexpr bool isLogfmtSpecial(unsigned char character)
+            {
+                return character <= ' ' || character == '=' || character == '"';
+            }
+
+            constexpr uint64_t hasLogfmtSpecial(uint64_t word)
+            {
+                return hasByteLowerThan(word, ' ' + 1) | hasByte(word, '=') | hasByte(word, '"');
+            }
+
+            /*!
+             * \brief Finds the first special character of a text, skipping 8 bytes at a time while no byte is special
+             * \param text The text to scan
+             * \param position The position where the scan starts
+             * \return The position of the first special character, or the size of the text if there is none
+             */
+            template<bool(*IS_SPECIAL)(unsigned char), uint64_t(*HAS_SPECIAL)(uint64_t)>
+            size_t findSpecial(std::string_view text, size_t position)
+            {
+                while(position + sizeof(uint64_t) <= text.size())
+                {
+                    uint64_t word;
+                    std::memcpy(&word, text.data() + position, sizeof(word));
+                    if(HAS_SPECIAL(word) != 0)
+                        break;
+
+                    position += sizeof(uint64_t);
+                }
+
+                while(position < text.size() && !IS_SPECIAL(static_cast<unsigned char>(text[position])))
+                    position++;
+
+                return position;
+            }
+
+            /*!
+             * \brief Appends a text with its special characters escaped, without quotes
+             * \param output [out] The string the text is appended to
+             * \param text The text to append
+             */
+            void appendEscaped(std::string& output, std::string_view text)
+            {
+                size_t runStart = 0;
+
+                while(true)
+                {
+                    const size_t special = findSpecial<isEscaped, hasEscaped>(text, runStart);
+                    output.append(text.data() + runStart, special - runStart);
+
+                    if(special == text.size())
+                        return;
+
+                    const auto character = static_cast<unsigned char>(text[special]);
+                    switch(character)
+                    {
+                        case '"':
+                            output += "\\\"";
+                            break;
+                        case '\\':
+                            output += "\\\\";
+                            break;
+                        case '\n':
+                            output += "\\n";
+                            break;
+                        case '\r':
+                            output += "\\r";
+                            break;
+                        case '\t':
+                            output += "\\t";
+                            break;
+                        default:
+                            output += "\\u00";
+                            output += HEX_DIGITS[character >> 4];
+                            output += HEX_DIGITS[character & 0xF];
+                    }
+
+                    runStart = special + 1;
+                }
+            }
+
+            /*!
+             * \brief Appends the value of a field
+             * \param output [out] The string the value is appended to
+             * \param value The value to append
+             * \param json True to follow the JSON syntax, false for logfmt
+             */
+            void appendFieldValue(std::string& output, const Field::Value& value, bool json)
+            {
+                std::visit([&output, json](const auto& content)
+                {
+                    using T = std::decay_t<decltype(content)>;
+
+                    if constexpr(std::is_same_v<T, std::string_view>)
+                    {
+                        if(json)
+                            appendJsonString(output, content);
+                        else
+                            appendLogfmtString(output, content);
+                    }
+                    else if constexpr(std::is_same_v<T, double>)
+                    {
+                        // JSON has no representation for infinities and NaN
+                        if(json && !std::isfinite(content))
+                            output += "null";
+                        else
+                            appendArgument(output, content);
+                    }
+                    else
+                        appendArgument(output, content);
+                }, value);
+            }
+        }
+
+        void appendJsonString(std::string& output, std::string_view text)
+        {
+            output += '"';
+            appendEscaped(output, text);
+            output += '"';
+        }
+
+        void appendLogfmtString(std::string& output, std::string_view text)
+        {
+            if(!text.empty() && findSpecial<isLogfmtSpecial, hasLogfmtSpecial>(text, 0) == text.size())
+            {
+                output += text;
+                return;
+            }
+
+            output += '"';
+            appendEscaped(output, text);
+            output += '"';
+        }
+
+        void appendLogfmtKey(std::string& output, std::string_view key)
+        {
+            if(key.empty())
+                output += '_';
+
+            for(const char character : key)
+                output += isLogfmtSpecial(static_cast<unsigned char>(character)) ? '_' : character;
+        }
+
+        void appendJsonFields(std::string& output, std::span<const Field> fields)
+        {
+            for(const Field& field : fields)
+            {
+                output += ',';
+                appendJsonString(output, field.getKey());
+                output += ':';
+                appendFieldValue(output, field.getValue(), true);
+            }
+        }
+
+        void appendLogfmtFields(std::string& output, std::span<const Field> fields)
+        {
+            for(size_t i = 0 ; i < fields.size() ; i++)
+            {
+                if(i != 0)
+                    output += ' ';
+
+                appendLogfmtKey(output, fields[i].getKey());
+                output += '=';
+                appendFieldValue(output, fields[i].getValue(), false);
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_TEXT_ESCAPING_HPP
+#define IKLOG_TEXT_ESCAPING_HPP
+
+#include "iklog/Field.hpp"
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace iklog
+{
+    namespace internal
+    {
+        /*!
+         * \brief Appends a string as a JSON string, surrounded by quotes and with its special characters escaped
+         *
+         * The text is scanned 8 bytes at a time, and the runs without special characters are appended at once
+         * \param output [out] The string the JSON string is appended to
+         * \param text The string to append
+         */
+        void appendJsonString(std::string& output, std::string_view text);
+
+        /*!
+         * \brief Appends a string as a logfmt value, quoted and escaped only if it is empty or contains spaces, '=', '"' or control characters
+         * \param output [out] The string the value is appended to
+         * \param text The string to append
+         */
+        void appendLogfmtString(std::string& output, std::string_view text);
+
+        /*!
+         * \brief Appends a logfmt key, its characters that are not allowed by logfmt being replaced by '_'
+         * \param output [out] The string the key is appended to
+         * \param key The key to append
+         */
+        void appendLogfmtKey(std::string& output, std::string_view key);
+
+        /*!
+         * \brief Appends fields as JSON members, each one preceded by a comma
+         * \param output [out] The string the members are appended to
+         * \param fields The fields to append
+         */
+        void appendJsonFields(std::string& output, std::span<const Field> fields);
+
+        /*!
+         * \brief Appends fields as logfmt pairs separated by spaces
+         * \param output [out] The string the pairs are appended to
+         * \param fields The fields to append
+         */
+        void appendLogfmtFields(std::string& output, std::span<const Field> fields);
+    }
+}
+
+#endif // IKLOG_TEXT_ESCAPING_HPP
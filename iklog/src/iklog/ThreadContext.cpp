@@ -0,0 +1,172 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/ThreadContext.hpp"
+#include "TextEscaping.hpp"
+#include <algorithm>
+#include <atomic>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace iklog
+{
+
+namespace
+{
+    std::atomic<uint64_t> nextVersion(1); // versions given to the contexts, 0 being the version of the empty contexts
+
+#ifndef __linux__
+    std::atomic<uint64_t> nextThreadId(1); // identifiers given to the threads where the system one is not available
+#endif
+
+    /*!
+     * \brief Finds an entry in a context
+     * \param entries The entries of the context
+     * \param key The key of the entry
+     * \return The iterator to the entry, or the end of the entries if the key is not present
+     */
+    auto findEntry(std::vector<std::pair<std::string, std::string>>& entries, std::string_view key)
+    {
+        return std::find_if(entries.begin(), entries.end(), [key](const auto& entry) { return entry.first == key; });
+    }
+}
+
+
+ThreadContext::Scope::Scope(std::string_view key, std::string_view value) :
+    m_key(key),
+    m_previousValue()
+{
+    ThreadContext& context = getCurrent();
+    const auto entry = findEntry(context.m_entries, key);
+
+    if(entry != context.m_entries.end())
+        m_previousValue = entry->second;
+
+    put(key, value);
+}
+
+ThreadContext::Scope::~Scope()
+{
+    if(m_previousValue.has_value())
+        put(m_key, *m_previousValue);
+    else
+        remove(m_key);
+}
+
+
+ThreadContext::ThreadContext() :
+    m_version(0)
+{}
+
+const ThreadContext& ThreadContext::current()
+{
+    return getCurrent();
+}
+
+ThreadContext& ThreadContext::getCurrent()
+{
+    thread_local ThreadContext context = []()
+    {
+        ThreadContext threadContext;
+
+#ifdef __linux__
+        threadContext.m_threadId = std::to_string(syscall(SYS_gettid));
+
+        char name[16] = {};
+        if(pthread_getname_np(pthread_self(), name, sizeof(name)) == 0)
+            threadContext.m_threadName = name;
+#else
+        // a small number, like the Linux one, so that it remains a number in the JSON messages
+        threadContext.m_threadId = std::to_string(nextThreadId.fetch_add(1, std::memory_order_relaxed));
+#endif
+
+        threadContext.update();
+        return threadContext;
+    }();
+
+    return context;
+}
+
+void ThreadContext::setThreadName(std::string_view name)
+{
+    ThreadContext& context = getCurrent();
+    context.m_threadName = name;
+    context.update();
+}
+
+void ThreadContext::put(std::string_view key, std::string_view value)
+{
+    ThreadContext& context = getCurrent();
+    const auto entry = findEntry(context.m_entries, key);
+
+    if(entry != context.m_entries.end())
+        entry->second = value;
+    else
+        context.m_entries.emplace_back(key, value);
+
+    context.update();
+}
+
+void ThreadContext::remove(std::string_view key)
+{
+    ThreadContext& context = getCurrent();
+    const auto entry = findEntry(context.m_entries, key);
+
+    if(entry != context.m_entries.end())
+    {
+        context.m_entries.erase(entry);
+        context.update();
+    }
+}
+
+void ThreadContext::clear()
+{
+    ThreadContext& context = getCurrent();
+    context.m_entries.clear();
+    context.update();
+}
+
+void ThreadContext::update()
+{
+    m_logfmtEntries.clear();
+    m_jsonEntries.clear();
+
+    for(const auto& [key, value] : m_entries)
+    {
+        if(!m_logfmtEntries.empty())
+            m_logfmtEntries += ' ';
+
+        internal::appendLogfmtKey(m_logfmtEntries, key);
+        m_logfmtEntries += '=';
+        internal::appendLogfmtString(m_logfmtEntries, value);
+
+        m_jsonEntries += ',';
+        internal::appendJsonString(m_jsonEntries, key);
+        m_jsonEntries += ':';
+        internal::appendJsonString(m_jsonEntries, value);
+    }
+
+    m_version = nextVersion.fetch_add(1, std::memory_order_relaxed);
+}
+
+}
@@ -0,0 +1,141 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/binary/BinaryLog.hpp"
+#include "../TextEscaping.hpp"
+#include <deque>
+#include <stdexcept>
+
+namespace iklog
+{
+
+namespace
+{
+    /*!
+     * \brief Gives the formats registered by all the binary logs, the index of a format is its identifier
+     */
+    std::deque<std::string>& getRegisteredFormats()
+    {
+        static std::deque<std::string> formats{std::string(internal::binary::RAW_MESSAGE_FORMAT_STRING)};
+        return formats;
+    }
+
+    std::mutex& getRegisteredFormatsMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+}
+
+
+BinaryLog::BinaryLog(const std::string& name, int levels, const std::string& filename) :
+    Log(name, levels, DEFAULT_OUTPUT, Formatter("")),
+    m_file(filename, std::ios::out | std::ios::binary | std::ios::trunc),
+    m_previousTime(getStartTime())
+{
+    if(!m_file.is_open())
+        throw std::runtime_error("Failed to open file '" + filename + "' in write mode");
+
+    // write the header
+    m_record.append(internal::binary::MAGIC, sizeof(internal::binary::MAGIC));
+    m_record += static_cast<char>(internal::binary::VERSION);
+    internal::appendVarint(m_record, name.size());
+    m_record += name;
+    internal::appendVarint(m_record, static_cast<uint64_t>(
+                               std::chrono::duration_cast<std::chrono::nanoseconds>(getStartTime().time_since_epoch()).count()));
+
+    m_file.write(m_record.data(), static_cast<std::streamsize>(m_record.size()));
+}
+
+BinaryLog::~BinaryLog()
+{
+    stopRateLimiterSummaries();
+}
+
+BinaryLog::FormatId BinaryLog::registerFormat(std::string_view format)
+{
+    std::lock_guard<std::mutex> lock(getRegisteredFormatsMutex());
+
+    std::deque<std::string>& formats = getRegisteredFormats();
+    formats.emplace_back(format);
+
+    return FormatId{static_cast<uint32_t>(formats.size() - 1)};
+}
+
+void BinaryLog::doLog(Level level, std::string_view message, std::span<const Field> fields) const
+{
+    // the message may have been rendered in the message buffer of the thread, so another buffer is needed
+    thread_local std::string buffer;
+    buffer.clear();
+
+    if(fields.empty())
+        internal::appendBinaryArguments(buffer, message);
+    else
+    {
+        thread_local std::string text;
+        text.assign(message);
+        text += ' ';
+        internal::appendLogfmtFields(text, fields);
+        internal::appendBinaryArguments(buffer, text);
+    }
+
+    writeEvent(level, FormatId{internal::binary::RAW_MESSAGE_FORMAT}, buffer);
+}
+
+void BinaryLog::writeEvent(Level level, FormatId format, std::string_view encodedArguments) const
+{
+    const Message::TimePoint now = getClock().now();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_record.clear();
+
+    // define the format in the file the first time it is used
+    if(format.value >= m_writtenFormats.size() || !m_writtenFormats[format.value])
+    {
+        std::string_view formatString;
+        {
+            std::lock_guard<std::mutex> formatsLock(getRegisteredFormatsMutex());
+            formatString = getRegisteredFormats().at(format.value);
+        }
+
+        m_record += static_cast<char>(internal::binary::FORMAT_RECORD);
+        internal::appendVarint(m_record, format.value);
+        internal::appendVarint(m_record, formatString.size());
+        m_record += formatString;
+
+        if(format.value >= m_writtenFormats.size())
+            m_writtenFormats.resize(format.value + 1, false);
+        m_writtenFormats[format.value] = true;
+    }
+
+    // write the event
+    m_record += static_cast<char>(internal::binary::EVENT_RECORD);
+    internal::appendVarint(m_record, format.value);
+    internal::appendVarint(m_record, static_cast<uint64_t>(level));
+    internal::appendVarint(m_record, internal::zigzagEncode(std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_previousTime).count()));
+    m_record += encodedArguments;
+
+    m_previousTime = now;
+
+    m_file.write(m_record.data(), static_cast<std::streamsize>(m_record.size()));
+    if(level == Level::ERROR)
+        m_file.flush();
+}
+
+}
@@ -0,0 +1,260 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/binary/BinaryLogReader.hpp"
+#include "iklog/binary/BinaryEncoding.hpp"
+#include "iklog/MessageFormat.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace iklog
+{
+
+using CreateResult = ikgen::Result<BinaryLogReader, std::string>;
+using DecodeResult = ikgen::Result<size_t, std::string>;
+using ReadResult = ikgen::Result<ikgen::EmptyResult, std::string>;
+
+
+CreateResult BinaryLogReader::create(const std::string& filename)
+{
+    try
+    {
+        return CreateResult::makeSuccess(filename);
+    }
+    catch(const std::runtime_error& e)
+    {
+        return CreateResult::makeFailure(e.what());
+    }
+}
+
+BinaryLogReader::BinaryLogReader(const std::string& filename) :
+    m_file(filename, std::ios::in | std::ios::binary),
+    m_fileSize(0)
+{
+    if(!m_file.is_open())
+        throw std::runtime_error("Failed to open file '" + filename + "' in read mode");
+
+    m_file.seekg(0, std::ios::end);
+    const std::streamoff fileSize = m_file.tellg();
+    m_file.seekg(0, std::ios::beg);
+    if(fileSize > 0)
+        m_fileSize = static_cast<uint64_t>(fileSize);
+
+    // read the header
+    char magic[sizeof(internal::binary::MAGIC)];
+    if(!m_file.read(magic, sizeof(magic)) || std::memcmp(magic, internal::binary::MAGIC, sizeof(magic)) != 0)
+        throw std::runtime_error("File '" + filename + "' is not a binary log file");
+
+    const int version = m_file.get();
+    if(version != internal::binary::VERSION)
+        throw std::runtime_error("Unsupported version of binary log file: " + std::to_string(version));
+
+    uint64_t startTime = 0;
+    if(!readString(m_logName) || !readVarint(startTime))
+        throw std::runtime_error("Incomplete header in binary log file '" + filename + "'");
+
+    m_startTime = Message::TimePoint(std::chrono::duration_cast<Message::TimePoint::duration>(
+                                         std::chrono::nanoseconds(static_cast<int64_t>(startTime))));
+}
+
+DecodeResult BinaryLogReader::decode(const Formatter& formatter, std::ostream& output)
+{
+    size_t decodedCount = 0;
+    Message::TimePoint eventTime = m_startTime;
+    std::string message;
+    std::string formatted;
+    const ThreadContext noThreadContext;
+
+    while(true)
+    {
+        const int tag = m_file.get();
+        if(tag == std::char_traits<char>::eof())
+            return DecodeResult::makeSuccess(decodedCount);
+
+        if(tag == internal::binary::FORMAT_RECORD)
+        {
+            uint64_t formatId = 0;
+            std::string format;
+            if(!readVarint(formatId) || !readString(format))
+                return DecodeResult::makeFailure("Unexpected end of file in a format definition");
+
+            if(formatId > internal::binary::MAX_FORMAT_ID)
+                return DecodeResult::makeFailure("Format definition has invalid identifier " + std::to_string(formatId));
+
+            if(formatId >= m_formats.size())
+                m_formats.resize(formatId + 1);
+            m_formats[formatId] = std::move(format);
+        }
+        else if(tag == internal::binary::EVENT_RECORD)
+        {
+            uint64_t formatId = 0;
+            uint64_t level = 0;
+            uint64_t timeDelta = 0;
+            if(!readVarint(formatId) || !readVarint(level) || !readVarint(timeDelta))
+                return DecodeResult::makeFailure("Unexpected end of file in an event");
+
+            if(formatId >= m_formats.size())
+                return DecodeResult::makeFailure("Event refers to undefined format " + std::to_string(formatId));
+
+            if(level != Level::INFO && level != Level::DEBUG && level != Level::WARNING && level != Level::ERROR)
+                return DecodeResult::makeFailure("Event has unknown level " + std::to_string(level));
+
+            message.clear();
+            ReadResult readResult = readMessage(m_formats[formatId], message);
+            if(readResult.isFailure())
+                return DecodeResult::failure(std::move(readResult.getFailure()));
+
+            eventTime += std::chrono::duration_cast<Message::TimePoint::duration>(
+                        std::chrono::nanoseconds(internal::zigzagDecode(timeDelta)));
+
+            formatted.clear();
+            // the thread of the event is not recorded, so it is not the one decoding the file that is written
+            formatter.format(Message(m_logName, static_cast<Level>(level), message, eventTime - m_startTime, eventTime,
+                                     {}, noThreadContext), formatted);
+            output << formatted << '\n';
+
+            decodedCount++;
+        }
+        else
+            return DecodeResult::makeFailure("Unknown record type " + std::to_string(tag));
+    }
+}
+
+bool BinaryLogReader::readVarint(uint64_t& value)
+{
+    value = 0;
+
+    for(unsigned int shift = 0 ; shift < 64 ; shift += 7)
+    {
+        const int byte = m_file.get();
+        if(byte == std::char_traits<char>::eof())
+            return false;
+
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if((byte & 0x80) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+bool BinaryLogReader::readString(std::string& value)
+{
+    uint64_t length = 0;
+    if(!readVarint(length))
+        return false;
+
+    // a corrupted length must not allocate more than the file could contain
+    const std::streamoff position = m_file.tellg();
+    if(position < 0 || static_cast<uint64_t>(position) + length > m_fileSize || length > m_fileSize)
+        return false;
+
+    value.resize(length);
+    return static_cast<bool>(m_file.read(value.data(), static_cast<std::streamsize>(length)));
+}
+
+ReadResult BinaryLogReader::readMessage(const std::string& format, std::string& message)
+{
+    const int argumentCount = m_file.get();
+    if(argumentCount == std::char_traits<char>::eof())
+        return ReadResult::makeFailure("Unexpected end of file in an event");
+
+    std::string::size_type position = 0;
+    std::string text;
+
+    for(int i = 0 ; i < argumentCount ; i++)
+    {
+        // copy the format up to the next placeholder, the argument is read anyway to move forward in the file
+        const std::string::size_type placeholder = format.find("{}", position);
+        if(placeholder != std::string::npos)
+            message.append(format, position, placeholder - position);
+
+        std::string argument;
+        const int type = m_file.get();
+        uint64_t integer = 0;
+
+        switch(static_cast<internal::BinaryType>(type))
+        {
+            case internal::BinaryType::BOOL_FALSE:
+                internal::appendArgument(argument, false);
+                break;
+            case internal::BinaryType::BOOL_TRUE:
+                internal::appendArgument(argument, true);
+                break;
+            case internal::BinaryType::CHAR:
+            {
+                const int character = m_file.get();
+                if(character == std::char_traits<char>::eof())
+                    return ReadResult::makeFailure("Unexpected end of file in an argument");
+                argument += static_cast<char>(character);
+                break;
+            }
+            case internal::BinaryType::SIGNED:
+                if(!readVarint(integer))
+                    return ReadResult::makeFailure("Unexpected end of file in an argument");
+                internal::appendArgument(argument, internal::zigzagDecode(integer));
+                break;
+            case internal::BinaryType::UNSIGNED:
+                if(!readVarint(integer))
+                    return ReadResult::makeFailure("Unexpected end of file in an argument");
+                internal::appendArgument(argument, integer);
+                break;
+            case internal::BinaryType::FLOAT:
+            {
+                float value = 0.f;
+                if(!m_file.read(reinterpret_cast<char*>(&value), sizeof(value)))
+                    return ReadResult::makeFailure("Unexpected end of file in an argument");
+                internal::appendArgument(argument, value);
+                break;
+            }
+            case internal::BinaryType::DOUBLE:
+            {
+                double value = 0.;
+                if(!m_file.read(reinterpret_cast<char*>(&value), sizeof(value)))
+                    return ReadResult::makeFailure("Unexpected end of file in an argument");
+                internal::appendArgument(argument, value);
+                break;
+            }
+            case internal::BinaryType::STRING:
+                if(!readString(text))
+                    return ReadResult::makeFailure("Unexpected end of file in an argument");
+                argument += text;
+                break;
+            case internal::BinaryType::POINTER:
+                if(!readVarint(integer))
+                    return ReadResult::makeFailure("Unexpected end of file in an argument");
+                internal::appendArgument(argument, reinterpret_cast<const void*>(static_cast<uintptr_t>(integer)));
+                break;
+            default:
+                return ReadResult::makeFailure("Unknown argument type " + std::to_string(type));
+        }
+
+        if(placeholder != std::string::npos)
+        {
+            message += argument;
+            position = placeholder + 2;
+        }
+    }
+
+    message.append(format, position);
+
+    return ReadResult::makeSuccess();
+}
+
+}
@@ -0,0 +1,478 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/compression/LzCompression.hpp"
+#include "iklog/binary/BinaryEncoding.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace iklog
+{
+    namespace lz
+    {
+        namespace
+        {
+            constexpr char MAGIC[4] = {'I', 'K', 'L', 'Z'};
+            constexpr uint8_t VERSION = 1;
+            constexpr size_t HEADER_SIZE = sizeof(MAGIC) + 1;
+
+            constexpr size_t BLOCK_SIZE = 1024 * 1024; // uncompressed size of the blocks, except the last one
+            constexpr size_t MAX_OFFSET = 0xFFFF; // farthest position a match can refer to
+            constexpr size_t MIN_MATCH = 4; // shortest match length, shorter repetitions are stored as literals
+            constexpr uint8_t LENGTH_MASK = 0x0F; // maximum length stored in a half token, longer ones are continued by extra bytes
+            constexpr unsigned int HASH_BITS = 16; // number of bits of the hash table index
+            constexpr size_t MAX_BLOCK_HEADER_SIZE = 20; // two varints of 64 bits
+
+
+            /*!
+             * \brief Reads 4 bytes without alignment requirement
+             */
+            inline uint32_t read32(const char* data)
+            {
+                uint32_t value;
+                std::memcpy(&value, data, sizeof(value));
+                return value;
+            }
+
+            /*!
+             * \brief Gives the hash table index of 4 bytes
+             */
+            inline uint32_t hash(uint32_t sequence)
+            {
+                return (sequence * 2654435761U) >> (32 - HASH_BITS);
+            }
+
+            /*!
+             * \brief Appends a length that did not fit in its half token: bytes of 255 followed by the remainder
+             */
+            inline void appendLengthExtension(std::string& output, size_t length)
+            {
+                for( ; length >= 0xFF ; length -= 0xFF)
+                    output += static_cast<char>(0xFF);
+                output += static_cast<char>(length);
+            }
+
+            /*!
+             * \brief Appends a sequence: literals followed by a match, or only literals at the end of a block
+             * \param output [out] The buffer the sequence is appended to
+             * \param literals Pointer to the literals
+             * \param literalsLength The number of literals
+             * \param offset The distance between the match and the position where it is copied, 0 at the end of a block
+             * \param matchLength The length of the match
+             */
+            void appendSequence(std::string& output, const char* literals, size_t literalsLength, size_t offset, size_t matchLength)
+            {
+                const size_t matchLengthCode = offset > 0 ? matchLength - MIN_MATCH : 0;
+                const uint8_t token = static_cast<uint8_t>((std::min<size_t>(literalsLength, LENGTH_MASK) << 4) |
+                                                           std::min<size_t>(matchLengthCode, LENGTH_MASK));
+                output += static_cast<char>(token);
+
+                if(literalsLength >= LENGTH_MASK)
+                    appendLengthExtension(output, literalsLength - LENGTH_MASK);
+                output.append(literals, literalsLength);
+
+                if(offset == 0)
+                    return;
+
+                output += static_cast<char>(offset & 0xFF);
+                output += static_cast<char>(offset >> 8);
+
+                if(matchLengthCode >= LENGTH_MASK)
+                    appendLengthExtension(output, matchLengthCode - LENGTH_MASK);
+            }
+
+            /*!
+             * \brief Compresses a block
+             * \param data Pointer to the data to compress
+             * \param length Length of the data, at most BLOCK_SIZE
+             * \param hashTable Table of 1 << HASH_BITS positions, used to find matches
+             * \param output [out] The buffer the compressed block is appended to
+             */
+            void compressBlock(const char* data, size_t length, uint32_t* hashTable, std::string& output)
+            {
+                // positions are stored + 1 so that 0 means no position
+                std::fill(hashTable, hashTable + (1 << HASH_BITS), 0);
+
+                size_t position = 0;
+                size_t anchor = 0; // start of the literals not written yet
+                size_t misses = 0; // positions without match since the last one, to skip data that does not compress
+
+                while(position + MIN_MATCH <= length)
+                {
+                    const uint32_t sequence = read32(data + position);
+                    uint32_t& entry = hashTable[hash(sequence)];
+                    const size_t candidate = entry;
+                    entry = static_cast<uint32_t>(position + 1);
+
+                    if(candidate == 0 || position - (candidate - 1) > MAX_OFFSET || read32(data + candidate - 1) != sequence)
+                    {
+                        position += 1 + (misses++ >> 6);
+                        continue;
+                    }
+
+                    const size_t match = candidate - 1;
+                    size_t matchLength = MIN_MATCH;
+                    while(position + matchLength < length && data[match + matchLength] == data[position + matchLength])
+                        matchLength++;
+
+                    appendSequence(output, data + anchor, position - anchor, position - match, matchLength);
+
+                    // index the positions covered by the match, so that the following data can refer to them
+                    const size_t matchEnd = position + matchLength;
+                    for(position++ ; position < matchEnd && position + MIN_MATCH <= length ; position++)
+                        hashTable[hash(read32(data + position))] = static_cast<uint32_t>(position + 1);
+
+                    position = matchEnd;
+                    anchor = matchEnd;
+                    misses = 0;
+                }
+
+                appendSequence(output, data + anchor, length - anchor, 0, 0);
+            }
+
+            /*!
+             * \brief Reads a length continued by extra bytes
+             * \return False if the data ends before the length
+             */
+            inline bool readLengthExtension(const char*& input, const char* inputEnd, size_t& length)
+            {
+                uint8_t byte;
+                do
+                {
+                    if(input == inputEnd)
+                        return false;
+
+                    byte = static_cast<uint8_t>(*input++);
+                    length += byte;
+                }
+                while(byte == 0xFF);
+
+                return true;
+            }
+
+            /*!
+             * \brief Decompresses a block
+             * \param input Pointer to the compressed block
+             * \param inputLength Length of the compressed block
+             * \param output Pointer to the buffer receiving the decompressed data
+             * \param outputLength Expected length of the decompressed data
+             * \return True in case of success, false if the block is not valid
+             */
+            bool decompressBlock(const char* input, size_t inputLength, char* output, size_t outputLength)
+            {
+                const char* const inputEnd = input + inputLength;
+                char* const outputStart = output;
+                char* const outputEnd = output + outputLength;
+
+                while(input < inputEnd)
+                {
+                    const uint8_t token = static_cast<uint8_t>(*input++);
+
+                    size_t literalsLength = token >> 4;
+                    if(literalsLength == LENGTH_MASK && !readLengthExtension(input, inputEnd, literalsLength))
+                        return false;
+
+                    if(literalsLength > static_cast<size_t>(inputEnd - input) || literalsLength > static_cast<size_t>(outputEnd - output))
+                        return false;
+
+                    std::memcpy(output, input, literalsLength);
+                    input += literalsLength;
+                    output += literalsLength;
+
+                    // the last sequence of the block has no match
+                    if(input == inputEnd)
+                        break;
+
+                    if(inputEnd - input < 2)
+                        return false;
+
+                    const size_t offset = static_cast<uint8_t>(input[0]) | (static_cast<size_t>(static_cast<uint8_t>(input[1])) << 8);
+                    input += 2;
+
+                    size_t matchLength = token & LENGTH_MASK;
+                    if(matchLength == LENGTH_MASK && !readLengthExtension(input, inputEnd, matchLength))
+                        return false;
+                    matchLength += MIN_MATCH;
+
+                    if(offset == 0 || offset > static_cast<size_t>(output - outputStart) || matchLength > static_cast<size_t>(outputEnd - output))
+                        return false;
+
+                    // the match may overlap the data being written, which repeats it
+                    const char* match = output - offset;
+                    if(offset >= matchLength)
+                        std::memcpy(output, match, matchLength);
+                    else
+                    {
+                        for(size_t i = 0 ; i < matchLength ; i++)
+                            output[i] = match[i];
+                    }
+                    output += matchLength;
+                }
+
+                return output == outputEnd;
+            }
+
+            /*!
+             * \brief Appends the compressed form of a block, with its header
+             */
+            void appendBlock(const char* data, size_t length, uint32_t* hashTable, std::string& output)
+            {
+                std::string compressed;
+                compressed.reserve(length + length / 255 + 16);
+                compressBlock(data, length, hashTable, compressed);
+
+                internal::appendVarint(output, length);
+                if(compressed.size() < length)
+                {
+                    internal::appendVarint(output, compressed.size());
+                    output += compressed;
+                }
+                else
+                {
+                    internal::appendVarint(output, 0);
+                    output.append(data, length);
+                }
+            }
+
+            /*!
+             * \brief Appends the header of the compressed data
+             */
+            inline void appendHeader(std::string& output)
+            {
+                output.append(MAGIC, sizeof(MAGIC));
+                output += static_cast<char>(VERSION);
+            }
+
+            /*!
+             * \brief Reads a variable length integer from a buffer
+             * \return False if the data ends before the integer
+             */
+            bool readVarint(const char*& input, const char* inputEnd, uint64_t& value)
+            {
+                value = 0;
+                for(unsigned int shift = 0 ; shift < 64 ; shift += 7)
+                {
+                    if(input == inputEnd)
+                        return false;
+
+                    const uint8_t byte = static_cast<uint8_t>(*input++);
+                    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                    if((byte & 0x80) == 0)
+                        return true;
+                }
+
+                return false;
+            }
+
+            /*!
+             * \brief Reads a variable length integer from a stream
+             * \return False if the stream ends before the integer
+             */
+            bool readVarint(std::istream& input, uint64_t& value)
+            {
+                value = 0;
+                for(unsigned int shift = 0 ; shift < 64 ; shift += 7)
+                {
+                    const int byte = input.get();
+                    if(byte == std::char_traits<char>::eof())
+                        return false;
+
+                    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                    if((byte & 0x80) == 0)
+                        return true;
+                }
+
+                return false;
+            }
+
+            /*!
+             * \brief Checks the header of compressed data
+             */
+            inline bool isHeaderValid(const char* header)
+            {
+                return std::memcmp(header, MAGIC, sizeof(MAGIC)) == 0 && static_cast<uint8_t>(header[sizeof(MAGIC)]) == VERSION;
+            }
+        }
+
+
+        std::string compress(std::string_view data)
+        {
+            std::unique_ptr<uint32_t[]> hashTable(new uint32_t[1 << HASH_BITS]);
+            std::string output;
+            output.reserve(data.size() / 2 + 64);
+            appendHeader(output);
+
+            for(size_t blockStart = 0 ; blockStart < data.size() ; blockStart += BLOCK_SIZE)
+                appendBlock(data.data() + blockStart, std::min(BLOCK_SIZE, data.size() - blockStart), hashTable.get(), output);
+
+            internal::appendVarint(output, 0);
+            return output;
+        }
+
+        ikgen::Result<std::string, std::string> decompress(std::string_view data)
+        {
+            if(data.size() < HEADER_SIZE || !isHeaderValid(data.data()))
+                return ikgen::Result<std::string, std::string>::failure("Not a compressed data");
+
+            const char* input = data.data() + HEADER_SIZE;
+            const char* const inputEnd = data.data() + data.size();
+            std::string output;
+
+            while(true)
+            {
+                uint64_t rawSize, storedSize;
+                if(!readVarint(input, inputEnd, rawSize))
+                    return ikgen::Result<std::string, std::string>::failure("Truncated compressed data");
+
+                if(rawSize == 0)
+                    return ikgen::Result<std::string, std::string>::success(std::move(output));
+
+                if(rawSize > BLOCK_SIZE || !readVarint(input, inputEnd, storedSize) || storedSize > static_cast<uint64_t>(inputEnd - input)
+                   || (storedSize == 0 && rawSize > static_cast<uint64_t>(inputEnd - input)))
+                    return ikgen::Result<std::string, std::string>::failure("Invalid compressed block");
+
+                const size_t outputStart = output.size();
+                output.resize(outputStart + rawSize);
+
+                if(storedSize == 0)
+                {
+                    std::memcpy(output.data() + outputStart, input, rawSize);
+                    input += rawSize;
+                }
+                else
+                {
+                    if(!decompressBlock(input, storedSize, output.data() + outputStart, rawSize))
+                        return ikgen::Result<std::string, std::string>::failure("Invalid compressed block");
+                    input += storedSize;
+                }
+            }
+        }
+
+        ikgen::Result<uintmax_t, std::string> compress(std::istream& input, std::ostream& output)
+        {
+            std::unique_ptr<uint32_t[]> hashTable(new uint32_t[1 << HASH_BITS]);
+            std::vector<char> block(BLOCK_SIZE);
+            std::string compressed;
+            uintmax_t compressedSize = 0;
+
+            appendHeader(compressed);
+
+            while(input)
+            {
+                input.read(block.data(), static_cast<std::streamsize>(block.size()));
+                const size_t length = static_cast<size_t>(input.gcount());
+                if(length == 0)
+                    break;
+
+                appendBlock(block.data(), length, hashTable.get(), compressed);
+                output.write(compressed.data(), static_cast<std::streamsize>(compressed.size()));
+                compressedSize += compressed.size();
+                compressed.clear();
+            }
+
+            if(input.bad())
+                return ikgen::Result<uintmax_t, std::string>::makeFailure("Failed to read the data to compress");
+
+            internal::appendVarint(compressed, 0);
+            output.write(compressed.data(), static_cast<std::streamsize>(compressed.size()));
+            compressedSize += compressed.size();
+            output.flush();
+
+            if(!output)
+                return ikgen::Result<uintmax_t, std::string>::makeFailure("Failed to write the compressed data");
+            return ikgen::Result<uintmax_t, std::string>::makeSuccess(compressedSize);
+        }
+
+        ikgen::Result<uintmax_t, std::string> decompress(std::istream& input, std::ostream& output)
+        {
+            char header[HEADER_SIZE];
+            if(!input.read(header, HEADER_SIZE) || !isHeaderValid(header))
+                return ikgen::Result<uintmax_t, std::string>::makeFailure("Not a compressed data");
+
+            std::vector<char> compressed;
+            std::vector<char> block(BLOCK_SIZE);
+            uintmax_t decompressedSize = 0;
+
+            while(true)
+            {
+                uint64_t rawSize, storedSize;
+                if(!readVarint(input, rawSize))
+                    return ikgen::Result<uintmax_t, std::string>::makeFailure("Truncated compressed data");
+
+                if(rawSize == 0)
+                    break;
+
+                if(rawSize > BLOCK_SIZE || !readVarint(input, storedSize) || storedSize > BLOCK_SIZE + BLOCK_SIZE / 255 + MAX_BLOCK_HEADER_SIZE)
+                    return ikgen::Result<uintmax_t, std::string>::makeFailure("Invalid compressed block");
+
+                if(storedSize == 0)
+                {
+                    if(!input.read(block.data(), static_cast<std::streamsize>(rawSize)))
+                        return ikgen::Result<uintmax_t, std::string>::makeFailure("Truncated compressed data");
+                }
+                else
+                {
+                    compressed.resize(storedSize);
+                    if(!input.read(compressed.data(), static_cast<std::streamsize>(storedSize)))
+                        return ikgen::Result<uintmax_t, std::string>::makeFailure("Truncated compressed data");
+
+                    if(!decompressBlock(compressed.data(), storedSize, block.data(), rawSize))
+                        return ikgen::Result<uintmax_t, std::string>::makeFailure("Invalid compressed block");
+                }
+
+                output.write(block.data(), static_cast<std::streamsize>(rawSize));
+                decompressedSize += rawSize;
+            }
+
+            output.flush();
+            if(!output)
+                return ikgen::Result<uintmax_t, std::string>::makeFailure("Failed to write the decompressed data");
+            return ikgen::Result<uintmax_t, std::string>::makeSuccess(decompressedSize);
+        }
+
+        ikgen::Result<uintmax_t, std::string> compressFile(const std::string& inputFilename, const std::string& outputFilename)
+        {
+            std::ifstream input(inputFilename, std::ios::in | std::ios::binary);
+            if(!input.is_open())
+                return ikgen::Result<uintmax_t, std::string>::makeFailure("Failed to open file '" + inputFilename + "' in read mode");
+
+            std::ofstream output(outputFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+            if(!output.is_open())
+                return ikgen::Result<uintmax_t, std::string>::makeFailure("Failed to open file '" + outputFilename + "' in write mode");
+
+            return compress(input, output);
+        }
+
+        ikgen::Result<uintmax_t, std::string> decompressFile(const std::string& inputFilename, const std::string& outputFilename)
+        {
+            std::ifstream input(inputFilename, std::ios::in | std::ios::binary);
+            if(!input.is_open())
+                return ikgen::Result<uintmax_t, std::string>::makeFailure("Failed to open file '" + inputFilename + "' in read mode");
+
+            std::ofstream output(outputFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+            if(!output.is_open())
+                return ikgen::Result<uintmax_t, std::string>::makeFailure("Failed to open file '" + outputFilename + "' in write mode");
+
+            return decompress(input, output);
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "FileMaintenance.hpp"
+#include <cstdlib>
+
+namespace iklog
+{
+    namespace internal
+    {
+        FileMaintenance& FileMaintenance::getInstance()
+        {
+            static FileMaintenance* const fileMaintenance = []()
+            {
+                FileMaintenance* const instance = new FileMaintenance();
+                std::atexit(&FileMaintenance::waitForTasks);
+                return instance;
+            }();
+
+            return *fileMaintenance;
+        }
+
+        FileMaintenance::FileMaintenance()
+        {
+            std::thread(&FileMaintenance::run, this).detach();
+        }
+
+        void FileMaintenance::waitForTasks()
+        {
+            // the tasks are run in order, so the previous tasks are done when this one is
+            getInstance().post([]() {}).wait();
+        }
+
+        std::future<void> FileMaintenance::post(std::function<void()> task)
+        {
+            std::packaged_task<void()> packagedTask(std::move(task));
+            std::future<void> future = packagedTask.get_future();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_tasks.push_back(std::move(packagedTask));
+            }
+
+            m_condVar.notify_one();
+            return future;
+        }
+
+        void FileMaintenance::run()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            while(true)
+            {
+                if(m_tasks.empty())
+                {
+                    m_condVar.wait(lock);
+                    continue;
+                }
+
+                std::packaged_task<void()> task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+        }
+    }
+}
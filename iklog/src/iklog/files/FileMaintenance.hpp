@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_FILE_MAINTENANCE_HPP
+#define IKLOG_FILE_MAINTENANCE_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace iklog
+{
+    namespace internal
+    {
+        /*!
+         * \brief Background thread running the slow file operations of the outputs, like rolling files
+         *
+         * The tasks are run one at a time, in the order they were posted
+         */
+        class FileMaintenance
+        {
+            public:
+
+                /*!
+                 * \brief Gives the singleton instance, its thread is started on the first call
+                 *
+                 * The instance is never destroyed and its thread is detached, so that static outputs destroyed
+                 * at exit can still wait for their tasks. The tasks posted before exit are run before the static
+                 * objects created before the first call are destroyed
+                 * \return The singleton instance
+                 */
+                static FileMaintenance& getInstance();
+
+                /*!
+                 * \brief Adds a task to run in the background
+                 *
+                 * Exceptions thrown by the task are stored in the returned future
+                 * \param task The task to run
+                 * \return A future that is ready when the task has been run
+                 */
+                std::future<void> post(std::function<void()> task);
+
+            private:
+
+                FileMaintenance();
+
+                /*!
+                 * \brief Waits until the tasks posted so far have been run, called at exit
+                 */
+                static void waitForTasks();
+
+                /*!
+                 * \brief Runs the thread
+                 */
+                void run();
+
+
+                std::mutex m_mutex; // protects the tasks
+                std::condition_variable m_condVar; // wakes the thread up when a task is posted
+                std::deque<std::packaged_task<void()>> m_tasks; // tasks waiting to be run
+        };
+    }
+}
+
+#endif // IKLOG_FILE_MAINTENANCE_HPP
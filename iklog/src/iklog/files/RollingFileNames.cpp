@@ -0,0 +1,109 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/files/RollingFileNames.hpp"
+#include "iklog/compression/LzCompression.hpp"
+#include <filesystem>
+#include <fstream>
+
+namespace iklog
+{
+    namespace internal
+    {
+
+        RollingFileNames::RollingFileNames(const std::string& baseFilename, unsigned int maxRollingFiles) :
+            m_maxRoll(maxRollingFiles - 1),
+            m_baseFilenameSep(baseFilename + SEPARATOR),
+            m_firstRollingFileName(m_baseFilenameSep + '0'),
+            m_lastRollingFileName(m_baseFilenameSep + std::to_string(m_maxRoll)),
+            m_nextRollingFileName(m_baseFilenameSep + NEXT_SUFFIX)
+        {}
+
+        void RollingFileNames::shift() const
+        {
+            // if the last file of the rolling system exists, then we have to remove it
+            for(const std::string& lastFile : {m_lastRollingFileName, m_lastRollingFileName + lz::FILE_EXTENSION})
+            {
+                if(std::filesystem::exists(lastFile))
+                    std::filesystem::remove(lastFile);
+            }
+
+            // roll the files if they exist
+            for(int roll = static_cast<int>(m_maxRoll) - 1 ; roll >= 0 ; roll--)
+            {
+                const std::string fileToRoll = getName(static_cast<unsigned int>(roll));
+                const std::string rolledFile = getName(static_cast<unsigned int>(roll + 1));
+
+                if(std::filesystem::exists(fileToRoll))
+                    std::filesystem::rename(fileToRoll, rolledFile);
+
+                if(std::filesystem::exists(fileToRoll + lz::FILE_EXTENSION))
+                    std::filesystem::rename(fileToRoll + lz::FILE_EXTENSION, rolledFile + lz::FILE_EXTENSION);
+            }
+        }
+
+        void RollingFileNames::promoteNext() const
+        {
+            shift();
+            std::filesystem::rename(m_nextRollingFileName, m_firstRollingFileName);
+        }
+
+        void RollingFileNames::compress(unsigned int index) const
+        {
+            const std::string filename = getName(index);
+            if(!std::filesystem::exists(filename))
+                return;
+
+            const std::string compressedFilename = filename + lz::FILE_EXTENSION;
+            const std::string temporaryFilename = compressedFilename + TEMPORARY_SUFFIX;
+
+            if(lz::compressFile(filename, temporaryFilename).isFailure())
+            {
+                std::error_code error;
+                std::filesystem::remove(temporaryFilename, error);
+                return;
+            }
+
+            std::filesystem::rename(temporaryFilename, compressedFilename);
+            std::filesystem::remove(filename);
+        }
+
+        void RollingFileNames::recover() const
+        {
+            std::error_code error;
+
+            for(unsigned int index = 0 ; index <= m_maxRoll ; index++)
+                std::filesystem::remove(getName(index) + lz::FILE_EXTENSION + TEMPORARY_SUFFIX, error);
+
+            if(!std::filesystem::exists(m_nextRollingFileName, error))
+                return;
+
+            // the next file may have been preallocated, it contains data only if it does not start with a null byte
+            std::ifstream nextFile(m_nextRollingFileName, std::ios::in | std::ios::binary);
+            const int firstByte = nextFile.get();
+            nextFile.close();
+
+            if(firstByte != std::char_traits<char>::eof() && firstByte != '\0')
+                promoteNext();
+            else
+                std::filesystem::remove(m_nextRollingFileName);
+        }
+
+    }
+}
@@ -0,0 +1,81 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/metrics/LatencyHistogram.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace iklog
+{
+
+LatencyHistogram::Snapshot::Snapshot() :
+    m_bucketCounts(BUCKET_COUNT, 0),
+    m_count(0),
+    m_sum(0)
+{}
+
+uint64_t LatencyHistogram::Snapshot::getPercentile(double percentile) const
+{
+    if(m_count == 0)
+        return 0;
+
+    // rank of the value of the percentile, from 1 to the number of values
+    const double clamped = std::clamp(percentile, 0.0, 100.0);
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(m_count))));
+
+    uint64_t cumulatedCount = 0;
+    for(size_t i = 0 ; i < m_bucketCounts.size() ; i++)
+    {
+        cumulatedCount += m_bucketCounts[i];
+        if(cumulatedCount >= rank)
+            return getBucketUpperBound(i);
+    }
+
+    return getBucketUpperBound(m_bucketCounts.size() - 1);
+}
+
+void LatencyHistogram::Snapshot::merge(const Snapshot& other)
+{
+    for(size_t i = 0 ; i < m_bucketCounts.size() ; i++)
+        m_bucketCounts[i] += other.m_bucketCounts[i];
+
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+}
+
+LatencyHistogram::LatencyHistogram() :
+    m_buckets(),
+    m_sum(0)
+{}
+
+LatencyHistogram::Snapshot LatencyHistogram::getSnapshot() const
+{
+    Snapshot snapshot;
+
+    for(size_t i = 0 ; i < BUCKET_COUNT ; i++)
+    {
+        snapshot.m_bucketCounts[i] = m_buckets[i].load(std::memory_order_relaxed);
+        snapshot.m_count += snapshot.m_bucketCounts[i];
+    }
+
+    snapshot.m_sum = m_sum.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+}
@@ -0,0 +1,168 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/outputs/DeduplicatingOutput.hpp"
+
+namespace iklog
+{
+
+DeduplicatingOutput::DeduplicatingOutput(Output& output, std::chrono::milliseconds repeatTimeout) :
+    iklog::Output(),
+    m_output(output),
+    m_hasLastMessage(false),
+    m_lastLevel(Level::DEBUG),
+    m_lastContextVersion(0),
+    m_repeatCount(0),
+    m_collapsedCount(0)
+{
+    setFlushPolicy(FlushPolicy::periodic(repeatTimeout));
+}
+
+DeduplicatingOutput::~DeduplicatingOutput()
+{
+    stopPeriodicFlush();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    writeRepeatCount();
+}
+
+void DeduplicatingOutput::write(const Message& message, std::string_view formatted)
+{
+    // messages relayed without their text can only be compared by their formatted data, which may include a time
+    const std::string_view text = message.getMessage().empty() ? formatted : message.getMessage();
+    const OutputMetrics::WriteScope metricsScope(m_metrics, formatted.size());
+
+    // the version of a thread context identifies both its thread and its entries
+    const uint64_t contextVersion = message.getThreadContext().getVersion();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if(m_hasLastMessage && message.getLevel() == m_lastLevel && contextVersion == m_lastContextVersion &&
+       text == m_lastMessage && message.getLogName() == m_lastLogName && isSameFields(message.getFields()))
+    {
+        m_repeatCount++;
+        m_collapsedCount++;
+        return;
+    }
+
+    writeRepeatCount();
+
+    m_hasLastMessage = true;
+    m_lastLogName.assign(message.getLogName());
+    m_lastLevel = message.getLevel();
+    m_lastMessage.assign(text);
+    m_lastContextVersion = contextVersion;
+    storeFields(message.getFields());
+
+    m_output.write(message, formatted);
+}
+
+void DeduplicatingOutput::flush()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        writeRepeatCount();
+    }
+
+    m_output.flush();
+    m_metrics.countFlush();
+}
+
+uint64_t DeduplicatingOutput::getCollapsedCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_collapsedCount;
+}
+
+void DeduplicatingOutput::doWrite(std::string_view data)
+{
+    writeRepeatCount();
+
+    const Message::TimePoint now = std::chrono::system_clock::now();
+    m_output.write(Message("", Level::DEBUG, "", Message::Duration::zero(), now), data);
+}
+
+void DeduplicatingOutput::doFlush()
+{
+    writeRepeatCount();
+    m_output.flush();
+}
+
+bool DeduplicatingOutput::isSameFields(std::span<const Field> fields) const
+{
+    if(fields.size() != m_lastFields.size())
+        return false;
+
+    for(size_t i = 0 ; i < fields.size() ; i++)
+    {
+        const auto& [key, value] = m_lastFields[i];
+        if(fields[i].getKey() != key || fields[i].getValue().index() != value.index())
+            return false;
+
+        const bool isSameValue = std::visit([&value = value](const auto& fieldValue)
+        {
+            using T = std::decay_t<decltype(fieldValue)>;
+            if constexpr(std::is_same_v<T, std::string_view>)
+                return fieldValue == std::get<std::string>(value);
+            else
+                return fieldValue == std::get<T>(value);
+        }, fields[i].getValue());
+
+        if(!isSameValue)
+            return false;
+    }
+
+    return true;
+}
+
+void DeduplicatingOutput::storeFields(std::span<const Field> fields)
+{
+    m_lastFields.resize(fields.size());
+
+    for(size_t i = 0 ; i < fields.size() ; i++)
+    {
+        m_lastFields[i].first.assign(fields[i].getKey());
+        std::visit([&value = m_lastFields[i].second](const auto& fieldValue)
+        {
+            using T = std::decay_t<decltype(fieldValue)>;
+            if constexpr(std::is_same_v<T, std::string_view>)
+                value.emplace<std::string>(fieldValue);
+            else
+                value = fieldValue;
+        }, fields[i].getValue());
+    }
+}
+
+void DeduplicatingOutput::writeRepeatCount()
+{
+    if(m_repeatCount == 0)
+        return;
+
+    const std::string text = "Last message repeated " + std::to_string(m_repeatCount) + " times";
+    const std::string line = text + '\n';
+
+    // the next message starts a new series, even if it is the same as the previous one
+    m_hasLastMessage = false;
+    m_repeatCount = 0;
+
+    const Message::TimePoint now = std::chrono::system_clock::now();
+    m_output.write(Message(m_lastLogName, m_lastLevel, text, Message::Duration::zero(), now), line);
+}
+
+}
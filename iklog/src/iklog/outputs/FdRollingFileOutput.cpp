@@ -0,0 +1,355 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/outputs/FdRollingFileOutput.hpp"
+#include "iklog/files/FileMaintenance.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+#ifdef _WIN32
+    #include <io.h>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+#else
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace iklog
+{
+
+namespace
+{
+
+#ifdef _WIN32
+    inline int openAppend(const std::string& filename, bool truncate)
+    {
+        return _open(filename.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY | (truncate ? _O_TRUNC : 0),
+                     _S_IREAD | _S_IWRITE);
+    }
+
+    inline long long writeFile(int fd, const char* data, std::size_t length)
+    {
+        return _write(fd, data, static_cast<unsigned int>(std::min<std::size_t>(length, INT_MAX)));
+    }
+
+    inline void closeFile(int fd) { _close(fd); }
+
+    inline uintmax_t getOpenedFileSize(int fd)
+    {
+        const long long size = _filelengthi64(fd);
+        return size > 0 ? static_cast<uintmax_t>(size) : 0;
+    }
+
+    inline void reserveFile(int, uintmax_t) {}
+
+    inline void releaseReservation(int, uintmax_t) {}
+#else
+    inline int openAppend(const std::string& filename, bool truncate)
+    {
+        return ::open(filename.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC | (truncate ? O_TRUNC : 0), 0644);
+    }
+
+    inline long long writeFile(int fd, const char* data, std::size_t length)
+    {
+        return ::write(fd, data, length);
+    }
+
+    inline void closeFile(int fd) { ::close(fd); }
+
+    inline uintmax_t getOpenedFileSize(int fd)
+    {
+        struct stat fileStat;
+        return ::fstat(fd, &fileStat) == 0 ? static_cast<uintmax_t>(fileStat.st_size) : 0;
+    }
+
+    // the reserved space is kept out of the file size, so that appending still writes after the actual data
+    inline void reserveFile([[maybe_unused]] int fd, [[maybe_unused]] uintmax_t size)
+    {
+    #ifdef __linux__
+        ::fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(size));
+    #endif
+    }
+
+    // gives back the reserved space that was not used, truncating at the actual size frees the blocks beyond it
+    inline void releaseReservation([[maybe_unused]] int fd, [[maybe_unused]] uintmax_t size)
+    {
+    #ifdef __linux__
+        ::ftruncate(fd, static_cast<off_t>(size));
+    #endif
+    }
+#endif
+
+}
+
+FdRollingFileOutput::FdRollingFileOutput(const std::string& baseFilename, const Bytes& maxFileSize, unsigned int maxRollingFiles,
+                                         std::size_t bufferSize, bool preallocate) :
+    FdRollingFileOutput(baseFilename, maxRollingFiles, maxFileSize.getValueInBytes(), bufferSize, preallocate)
+{}
+
+FdRollingFileOutput::FdRollingFileOutput(const std::string& baseFilename, const KiloBytes& maxFileSize, unsigned int maxRollingFiles,
+                                         std::size_t bufferSize, bool preallocate) :
+    FdRollingFileOutput(baseFilename, maxRollingFiles, maxFileSize.getValueInBytes(), bufferSize, preallocate)
+{}
+
+FdRollingFileOutput::FdRollingFileOutput(const std::string& baseFilename, const MegaBytes& maxFileSize, unsigned int maxRollingFiles,
+                                         std::size_t bufferSize, bool preallocate) :
+    FdRollingFileOutput(baseFilename, maxRollingFiles, maxFileSize.getValueInBytes(), bufferSize, preallocate)
+{}
+
+FdRollingFileOutput::FdRollingFileOutput(const std::string& baseFilename, const GigaBytes& maxFileSize, unsigned int maxRollingFiles,
+                                         std::size_t bufferSize, bool preallocate) :
+    FdRollingFileOutput(baseFilename, maxRollingFiles, maxFileSize.getValueInBytes(), bufferSize, preallocate)
+{}
+
+FdRollingFileOutput::FdRollingFileOutput(const std::string& baseFilename, unsigned int maxRollingFiles, uintmax_t maxFileSize,
+                                         std::size_t bufferSize, bool preallocate) :
+    iklog::Output(),
+    m_fd(-1),
+    m_nextFd(-1),
+    m_nextFileInUse(false),
+    m_compressRolledFiles(false),
+    m_maxFileSize(maxFileSize),
+    m_fileSize(0),
+    m_preallocate(preallocate),
+    m_buffer(new char[std::max<std::size_t>(bufferSize, 1)]),
+    m_bufferCapacity(std::max<std::size_t>(bufferSize, 1)),
+    m_bufferLength(0),
+    m_fileNames(baseFilename, maxRollingFiles)
+{
+    assert(m_maxFileSize > 0);
+    assert(maxRollingFiles > 0);
+    open();
+}
+
+FdRollingFileOutput::~FdRollingFileOutput()
+{
+    stopPeriodicFlush();
+    doFlush();
+
+    if(m_nextFilePreparation.valid())
+        m_nextFilePreparation.wait();
+
+    if(m_fd >= 0)
+    {
+        if(m_preallocate)
+            releaseReservation(m_fd, m_fileSize);
+        closeFile(m_fd);
+    }
+
+    // the unused next file is removed, but if we write to it, it is kept to be promoted at the next start
+    if(m_nextFd >= 0)
+        closeFile(m_nextFd);
+    if(!m_nextFileInUse)
+    {
+        std::error_code error;
+        std::filesystem::remove(m_fileNames.getNext(), error);
+    }
+}
+
+void FdRollingFileOutput::setRolledFilesCompression(bool compress)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_compressRolledFiles = compress;
+}
+
+bool FdRollingFileOutput::isCompressingRolledFiles()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_compressRolledFiles;
+}
+
+uintmax_t FdRollingFileOutput::getFileSize()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_fileSize;
+}
+
+void FdRollingFileOutput::doWrite(std::string_view data)
+{
+    // if the file would become too large, do the rolling
+    if(m_fileSize > 0 && m_fileSize + data.size() > m_maxFileSize && isNextFileReady())
+        roll();
+
+    m_fileSize += data.size();
+
+    if(m_bufferLength + data.size() > m_bufferCapacity)
+    {
+        doFlush();
+
+        // data larger than the buffer is written directly
+        if(data.size() >= m_bufferCapacity)
+        {
+            writeToFile(data.data(), data.size());
+            return;
+        }
+    }
+
+    std::memcpy(m_buffer.get() + m_bufferLength, data.data(), data.size());
+    m_bufferLength += data.size();
+}
+
+void FdRollingFileOutput::doFlush()
+{
+    writeToFile(m_buffer.get(), m_bufferLength);
+    m_bufferLength = 0;
+}
+
+void FdRollingFileOutput::open()
+{
+    m_fileNames.recover();
+
+    m_fd = openAppend(m_fileNames.getFirst(), false);
+    if(m_fd < 0)
+        throw std::runtime_error("Failed to open file '" + m_fileNames.getFirst() + "' in write mode: " + std::strerror(errno));
+
+    m_fileSize = getOpenedFileSize(m_fd);
+    if(m_preallocate && m_fileSize < m_maxFileSize)
+        reserveFile(m_fd, m_maxFileSize);
+
+#ifndef _WIN32
+    if(!openNextFile())
+        throw std::runtime_error("Failed to open file '" + m_fileNames.getNext() + "' in write mode: " + std::strerror(errno));
+#endif
+}
+
+bool FdRollingFileOutput::openNextFile()
+{
+    m_nextFd = openAppend(m_fileNames.getNext(), true);
+    if(m_nextFd < 0)
+        return false;
+
+    if(m_preallocate)
+        reserveFile(m_nextFd, m_maxFileSize);
+    return true;
+}
+
+void FdRollingFileOutput::roll()
+{
+    m_metrics.countRoll();
+
+    doFlush();
+
+#ifdef _WIN32
+    // open files cannot be renamed on Windows, so the rolling is done here
+    if(m_fd >= 0)
+    {
+        if(m_preallocate)
+            releaseReservation(m_fd, m_fileSize);
+        closeFile(m_fd);
+    }
+
+    m_fileNames.shift();
+    m_fd = openAppend(m_fileNames.getFirst(), true);
+    m_fileSize = 0;
+    if(m_fd >= 0 && m_preallocate)
+        reserveFile(m_fd, m_maxFileSize);
+#else
+    const int previousFd = m_fd;
+    const uintmax_t previousSize = m_fileSize;
+
+    m_fd = m_nextFd;
+    m_nextFd = -1;
+    m_nextFileInUse = true;
+    m_fileSize = 0;
+
+    prepareNextFile(previousFd, previousSize);
+#endif
+
+    // the previous file becomes the file with index 1 in the task above, the compression is done after it
+    if(m_compressRolledFiles)
+        internal::FileMaintenance::getInstance().post([fileNames = m_fileNames]() { fileNames.compress(1); });
+}
+
+void FdRollingFileOutput::prepareNextFile(int previousFd, uintmax_t previousSize)
+{
+    m_nextFilePreparation = internal::FileMaintenance::getInstance().post([this, previousFd, previousSize]()
+    {
+        if(previousFd >= 0)
+        {
+            if(m_preallocate)
+                releaseReservation(previousFd, previousSize);
+            closeFile(previousFd);
+        }
+
+        if(m_nextFileInUse)
+        {
+            m_fileNames.promoteNext();
+            m_nextFileInUse = false;
+        }
+
+        openNextFile();
+    });
+}
+
+bool FdRollingFileOutput::isNextFileReady()
+{
+#ifdef _WIN32
+    return true;
+#else
+    if(m_nextFilePreparation.valid() &&
+       m_nextFilePreparation.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+
+    // the preparation failed, try again
+    if(m_nextFileInUse || m_nextFd < 0)
+    {
+        prepareNextFile(-1, 0);
+        return false;
+    }
+
+    return true;
+#endif
+}
+
+void FdRollingFileOutput::writeToFile(const char* data, std::size_t length)
+{
+    // the file could not be opened again after a rolling
+    if(m_fd < 0)
+    {
+        if(length > 0)
+            m_metrics.countWriteError();
+        return;
+    }
+
+    while(length > 0)
+    {
+        const long long written = writeFile(m_fd, data, length);
+        if(written < 0)
+        {
+            if(errno == EINTR)
+                continue;
+
+            // the data is lost, like with a failed stream
+            m_metrics.countWriteError();
+            return;
+        }
+
+        data += written;
+        length -= static_cast<std::size_t>(written);
+    }
+}
+
+}
@@ -0,0 +1,232 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/outputs/FlightRecorderOutput.hpp"
+#include <algorithm>
+#include <climits>
+#include <csignal>
+#include <cstring>
+
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace iklog
+{
+
+namespace
+{
+
+#ifdef _WIN32
+    inline long long writeFile(int fd, const char* data, std::size_t length)
+    {
+        return _write(fd, data, static_cast<unsigned int>(std::min<std::size_t>(length, INT_MAX)));
+    }
+#else
+    inline long long writeFile(int fd, const char* data, std::size_t length)
+    {
+        return ::write(fd, data, length);
+    }
+#endif
+
+    // writes all the data, only using functions that can be called from a signal handler
+    void writeAll(int fd, const char* data, std::size_t length)
+    {
+        while(length > 0)
+        {
+            const long long written = writeFile(fd, data, length);
+            if(written <= 0)
+                return;
+
+            data += written;
+            length -= static_cast<std::size_t>(written);
+        }
+    }
+
+
+    constexpr int FATAL_SIGNALS[] = {
+        SIGSEGV, SIGABRT, SIGFPE, SIGILL,
+#ifdef SIGBUS
+        SIGBUS
+#endif
+    };
+
+    std::atomic<const FlightRecorderOutput*> signalRecorder = nullptr; // recorder dumped on fatal signals
+    std::atomic<int> signalFd = 2; // file descriptor the recorder is dumped to on fatal signals
+
+    extern "C" void dumpOnSignal(int signal)
+    {
+        const FlightRecorderOutput* recorder = signalRecorder.load();
+        if(recorder != nullptr)
+            recorder->dumpToFileDescriptor(signalFd.load());
+
+        std::signal(signal, SIG_DFL);
+        std::raise(signal);
+    }
+
+}
+
+FlightRecorderOutput::FlightRecorderOutput(Output& dumpOutput, size_t capacity, int dumpLevels) :
+    iklog::Output(),
+    m_dumpOutput(dumpOutput),
+    m_capacity(std::max(capacity, sizeof(RecordHeader) + 1)),
+    m_dumpLevels(dumpLevels),
+    m_ring(std::make_unique<char[]>(m_capacity)),
+    m_begin(0),
+    m_size(0)
+{}
+
+FlightRecorderOutput::~FlightRecorderOutput()
+{
+    stopPeriodicFlush();
+
+    const FlightRecorderOutput* recorder = this;
+    signalRecorder.compare_exchange_strong(recorder, nullptr);
+}
+
+void FlightRecorderOutput::write(const Message& message, std::string_view formatted)
+{
+    const OutputMetrics::WriteScope metricsScope(m_metrics, formatted.size());
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    record(message.getClockTime(), message.getLevel(), formatted);
+
+    if((m_dumpLevels & message.getLevel()) != 0)
+        dumpRecords();
+}
+
+void FlightRecorderOutput::flush()
+{}
+
+void FlightRecorderOutput::dump()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    dumpRecords();
+}
+
+void FlightRecorderOutput::dumpToFileDescriptor(int fd) const
+{
+    const size_t begin = m_begin.load(std::memory_order_acquire);
+    size_t remaining = std::min(m_size.load(std::memory_order_acquire), m_capacity);
+    size_t offset = begin;
+
+    while(remaining >= sizeof(RecordHeader))
+    {
+        RecordHeader header;
+        copyFromRing(offset, &header, sizeof(RecordHeader));
+        offset = (offset + sizeof(RecordHeader)) % m_capacity;
+        remaining -= sizeof(RecordHeader);
+
+        // the ring may be modified while it is read, never go past the recorded data
+        const size_t size = std::min<size_t>(header.size, remaining);
+        const size_t firstPart = std::min(size, m_capacity - offset);
+        writeAll(fd, m_ring.get() + offset, firstPart);
+        writeAll(fd, m_ring.get(), size - firstPart);
+
+        offset = (offset + size) % m_capacity;
+        remaining -= size;
+    }
+}
+
+void FlightRecorderOutput::dumpOnFatalSignals(int fd)
+{
+    signalFd.store(fd);
+    signalRecorder.store(this);
+
+    for(int signal : FATAL_SIGNALS)
+        std::signal(signal, dumpOnSignal);
+}
+
+void FlightRecorderOutput::doWrite(std::string_view data)
+{
+    record(std::chrono::system_clock::now(), Level::DEBUG, data);
+}
+
+void FlightRecorderOutput::doFlush()
+{}
+
+void FlightRecorderOutput::record(const Message::TimePoint& clockTime, Level level, std::string_view formatted)
+{
+    const size_t size = std::min(formatted.size(), std::min<size_t>(m_capacity - sizeof(RecordHeader), UINT32_MAX));
+    const size_t recordSize = sizeof(RecordHeader) + size;
+
+    // forget the oldest messages until the new one fits
+    size_t begin = m_begin.load(std::memory_order_relaxed);
+    size_t used = m_size.load(std::memory_order_relaxed);
+    while(m_capacity - used < recordSize)
+    {
+        RecordHeader oldest;
+        copyFromRing(begin, &oldest, sizeof(RecordHeader));
+        begin = (begin + sizeof(RecordHeader) + oldest.size) % m_capacity;
+        used -= sizeof(RecordHeader) + oldest.size;
+    }
+
+    m_begin.store(begin, std::memory_order_release);
+    m_size.store(used, std::memory_order_release);
+
+    const RecordHeader header{clockTime, static_cast<uint32_t>(size), level};
+    const size_t end = (begin + used) % m_capacity;
+    copyToRing(end, &header, sizeof(RecordHeader));
+    copyToRing((end + sizeof(RecordHeader)) % m_capacity, formatted.data(), size);
+
+    m_size.store(used + recordSize, std::memory_order_release);
+}
+
+void FlightRecorderOutput::dumpRecords()
+{
+    size_t offset = m_begin.load(std::memory_order_relaxed);
+    size_t remaining = m_size.load(std::memory_order_relaxed);
+
+    while(remaining > 0)
+    {
+        RecordHeader header;
+        copyFromRing(offset, &header, sizeof(RecordHeader));
+        offset = (offset + sizeof(RecordHeader)) % m_capacity;
+
+        m_dumpBuffer.resize(header.size);
+        copyFromRing(offset, m_dumpBuffer.data(), header.size);
+        offset = (offset + header.size) % m_capacity;
+        remaining -= sizeof(RecordHeader) + header.size;
+
+        m_dumpOutput.write(Message("", header.level, "", Message::Duration::zero(), header.clockTime), m_dumpBuffer);
+    }
+
+    m_begin.store(0, std::memory_order_release);
+    m_size.store(0, std::memory_order_release);
+
+    m_dumpOutput.flush();
+}
+
+void FlightRecorderOutput::copyToRing(size_t offset, const void* data, size_t size)
+{
+    const size_t firstPart = std::min(size, m_capacity - offset);
+    std::memcpy(m_ring.get() + offset, data, firstPart);
+    std::memcpy(m_ring.get(), static_cast<const char*>(data) + firstPart, size - firstPart);
+}
+
+void FlightRecorderOutput::copyFromRing(size_t offset, void* data, size_t size) const
+{
+    const size_t firstPart = std::min(size, m_capacity - offset);
+    std::memcpy(data, m_ring.get() + offset, firstPart);
+    std::memcpy(static_cast<char*>(data) + firstPart, m_ring.get(), size - firstPart);
+}
+
+}
@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "FlushTicker.hpp"
+#include <algorithm>
+
+namespace iklog
+{
+    namespace internal
+    {
+        FlushTicker& FlushTicker::getInstance()
+        {
+            static FlushTicker* const flushTicker = new FlushTicker();
+            return *flushTicker;
+        }
+
+        FlushTicker::FlushTicker()
+        {
+            std::thread(&FlushTicker::run, this).detach();
+        }
+
+        void FlushTicker::add(Output& output, std::chrono::milliseconds interval)
+        {
+            add(&output, [&output]() { output.flush(); }, interval);
+        }
+
+        void FlushTicker::remove(Output& output)
+        {
+            remove(static_cast<const void*>(&output));
+        }
+
+        void FlushTicker::add(const void* owner, std::function<void()> task, std::chrono::milliseconds interval)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                const auto nextRun = std::chrono::steady_clock::now() + interval;
+                auto it = std::find_if(m_entries.begin(), m_entries.end(), [owner](const Entry& entry) { return entry.owner == owner; });
+
+                if(it != m_entries.end())
+                    *it = Entry{owner, std::move(task), interval, nextRun};
+                else
+                    m_entries.push_back(Entry{owner, std::move(task), interval, nextRun});
+            }
+
+            m_condVar.notify_one();
+        }
+
+        void FlushTicker::remove(const void* owner)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::erase_if(m_entries, [owner](const Entry& entry) { return entry.owner == owner; });
+        }
+
+        void FlushTicker::run()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            while(true)
+            {
+                const auto now = std::chrono::steady_clock::now();
+                auto wakeUp = std::chrono::steady_clock::time_point::max();
+
+                for(Entry& entry : m_entries)
+                {
+                    if(entry.nextRun <= now)
+                    {
+                        entry.task();
+                        entry.nextRun = now + entry.interval;
+                    }
+
+                    wakeUp = std::min(wakeUp, entry.nextRun);
+                }
+
+                if(wakeUp == std::chrono::steady_clock::time_point::max())
+                    m_condVar.wait(lock);
+                else
+                    m_condVar.wait_until(lock, wakeUp);
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOG_FLUSH_TICKER_HPP
+#define IKLOG_FLUSH_TICKER_HPP
+
+#include "iklog/outputs/Output.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iklog
+{
+    namespace internal
+    {
+        /*!
+         * \brief Background thread flushing the outputs having a periodic flush policy
+         *
+         * It also runs the other periodic tasks of the library, like the summaries of the rate limiters of the Logs
+         */
+        class FlushTicker
+        {
+            public:
+
+                /*!
+                 * \brief Gives the singleton instance, its thread is started on the first call
+                 *
+                 * The instance is never destroyed and its thread is detached, so that static outputs destroyed
+                 * at exit can still stop their periodic flush
+                 * \return The singleton instance
+                 */
+                static FlushTicker& getInstance();
+
+                /*!
+                 * \brief Starts flushing an output periodically, or changes its interval if it is already flushed
+                 * \param output The output to flush
+                 * \param interval The time between two flushes
+                 */
+                void add(Output& output, std::chrono::milliseconds interval);
+
+                /*!
+                 * \brief Stops flushing an output, waits for its flush if it is in progress
+                 * \param output The output to stop flushing
+                 */
+                void remove(Output& output);
+
+                /*!
+                 * \brief Starts running a task periodically, or replaces the task of the owner if it already has one
+                 * \param owner The object the task belongs to, identifying it
+                 * \param task The task to run, called with the mutex of the ticker locked
+                 * \param interval The time between two runs
+                 */
+                void add(const void* owner, std::function<void()> task, std::chrono::milliseconds interval);
+
+                /*!
+                 * \brief Stops running the task of an owner, waits for it if it is in progress
+                 * \param owner The object the task belongs to
+                 */
+                void remove(const void* owner);
+
+            private:
+
+                struct Entry
+                {
+                    const void* owner;
+                    std::function<void()> task;
+                    std::chrono::milliseconds interval;
+                    std::chrono::steady_clock::time_point nextRun;
+                };
+
+                FlushTicker();
+
+                /*!
+                 * \brief Runs the thread
+                 */
+                void run();
+
+
+                std::mutex m_mutex; // protects the entries, and is held while running the tasks
+                std::condition_variable m_condVar; // wakes the thread up when the entries change
+                std::vector<Entry> m_entries; // tasks to run, such as flushing an output
+        };
+    }
+}
+
+#endif // IKLOG_FLUSH_TICKER_HPP
@@ -0,0 +1,370 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/outputs/MappedFileOutput.hpp"
+#include "iklog/files/FileMaintenance.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace iklog
+{
+
+namespace
+{
+
+#ifdef _WIN32
+    inline int openFile(const std::string&, bool) { errno = ENOSYS; return -1; }
+    inline uintmax_t getOpenedFileSize(int) { return 0; }
+    inline bool reserveFile(int, size_t) { return false; }
+    inline char* mapMemory(int, size_t) { return nullptr; }
+    inline void syncMapping(char*, size_t, bool) {}
+    inline void unmapFile(char*, size_t) {}
+    inline void truncateFile(int, size_t) {}
+    inline void closeFile(int) {}
+    inline size_t getPageSize() { return 1; }
+#else
+    inline int openFile(const std::string& filename, bool truncate)
+    {
+        return ::open(filename.c_str(), O_RDWR | O_CREAT | O_CLOEXEC | (truncate ? O_TRUNC : 0), 0644);
+    }
+
+    inline uintmax_t getOpenedFileSize(int fd)
+    {
+        struct stat fileStat;
+        return ::fstat(fd, &fileStat) == 0 ? static_cast<uintmax_t>(fileStat.st_size) : 0;
+    }
+
+    // the disk space is allocated up front, so that writing to the mapping cannot fail because the disk is full
+    inline bool reserveFile(int fd, size_t size)
+    {
+    #ifdef __APPLE__
+        return ::ftruncate(fd, static_cast<off_t>(size)) == 0;
+    #else
+        return ::posix_fallocate(fd, 0, static_cast<off_t>(size)) == 0;
+    #endif
+    }
+
+    inline char* mapMemory(int fd, size_t size)
+    {
+        void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        return data == MAP_FAILED ? nullptr : static_cast<char*>(data);
+    }
+
+    inline void syncMapping(char* data, size_t length, bool wait)
+    {
+        ::msync(data, length, wait ? MS_SYNC : MS_ASYNC);
+    }
+
+    inline void unmapFile(char* data, size_t size) { ::munmap(data, size); }
+
+    inline void truncateFile(int fd, size_t size)
+    {
+        if(::ftruncate(fd, static_cast<off_t>(size)) != 0)
+            return; // the file keeps its null bytes at the end, which are ignored when the file is opened again
+    }
+
+    inline void closeFile(int fd) { ::close(fd); }
+
+    inline size_t getPageSize()
+    {
+        static const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return pageSize;
+    }
+#endif
+
+    /*!
+     * \brief Gives the start of a range to synchronize, which must be aligned on a page
+     */
+    inline size_t alignOnPage(size_t position)
+    {
+        return position - position % getPageSize();
+    }
+
+}
+
+MappedFileOutput::MappedFileOutput(const std::string& baseFilename, const Bytes& maxFileSize, unsigned int maxRollingFiles) :
+    MappedFileOutput(baseFilename, maxRollingFiles, maxFileSize.getValueInBytes())
+{}
+
+MappedFileOutput::MappedFileOutput(const std::string& baseFilename, const KiloBytes& maxFileSize, unsigned int maxRollingFiles) :
+    MappedFileOutput(baseFilename, maxRollingFiles, maxFileSize.getValueInBytes())
+{}
+
+MappedFileOutput::MappedFileOutput(const std::string& baseFilename, const MegaBytes& maxFileSize, unsigned int maxRollingFiles) :
+    MappedFileOutput(baseFilename, maxRollingFiles, maxFileSize.getValueInBytes())
+{}
+
+MappedFileOutput::MappedFileOutput(const std::string& baseFilename, const GigaBytes& maxFileSize, unsigned int maxRollingFiles) :
+    MappedFileOutput(baseFilename, maxRollingFiles, maxFileSize.getValueInBytes())
+{}
+
+MappedFileOutput::MappedFileOutput(const std::string& baseFilename, unsigned int maxRollingFiles, uintmax_t maxFileSize) :
+    iklog::Output(),
+    m_mapping{-1, nullptr},
+    m_nextMapping{-1, nullptr},
+    m_nextFileInUse(false),
+    m_compressRolledFiles(false),
+    m_maxFileSize(static_cast<size_t>(std::min<uintmax_t>(maxFileSize, std::numeric_limits<size_t>::max()))),
+    m_position(0),
+    m_syncedPosition(0),
+    m_rollCount(0),
+    m_syncCount(0),
+    m_fileNames(baseFilename, maxRollingFiles)
+{
+    assert(m_maxFileSize > 0);
+    assert(maxRollingFiles > 0);
+    open();
+    setFlushPolicy(FlushPolicy::periodic(DEFAULT_SYNC_INTERVAL));
+}
+
+MappedFileOutput::~MappedFileOutput()
+{
+    stopPeriodicFlush();
+
+    if(m_nextFilePreparation.valid())
+        m_nextFilePreparation.wait();
+
+    releaseMapping(m_mapping, m_position);
+    releaseMapping(m_nextMapping, 0);
+
+    // the unused next file is removed, but if we write to it, it is kept to be promoted at the next start
+    if(!m_nextFileInUse)
+    {
+        std::error_code error;
+        std::filesystem::remove(m_fileNames.getNext(), error);
+    }
+}
+
+void MappedFileOutput::flush()
+{
+    char* start;
+    size_t length;
+    size_t position;
+    size_t rollCount;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(m_mapping.data == nullptr || m_syncedPosition == m_position)
+            return;
+
+        const size_t syncStart = alignOnPage(m_syncedPosition);
+        start = m_mapping.data + syncStart;
+        length = m_position - syncStart;
+        position = m_position;
+        rollCount = m_rollCount;
+
+        // the mapping is pinned before the mutex is released, so a rolling cannot unmap it during the synchronization
+        std::lock_guard<std::mutex> syncLock(m_syncMutex);
+        m_syncCount++;
+    }
+
+    syncMapping(start, length, true);
+
+    {
+        std::lock_guard<std::mutex> syncLock(m_syncMutex);
+        m_syncCount--;
+    }
+    m_syncCondition.notify_all();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // if the file has been rolled meanwhile, its data is synchronized when it is released
+        if(m_rollCount == rollCount && m_syncedPosition < position)
+            m_syncedPosition = position;
+    }
+
+    m_metrics.countFlush();
+}
+
+void MappedFileOutput::setRolledFilesCompression(bool compress)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_compressRolledFiles = compress;
+}
+
+bool MappedFileOutput::isCompressingRolledFiles()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_compressRolledFiles;
+}
+
+void MappedFileOutput::doWrite(std::string_view data)
+{
+    if(data.size() > m_maxFileSize)
+        data = data.substr(0, m_maxFileSize);
+
+    // if the data does not fit in the current file, do the rolling
+    if(data.size() > m_maxFileSize - m_position)
+    {
+        if(!waitNextFile())
+            return; // the data is lost, like with a failed stream
+
+        roll();
+    }
+
+    std::memcpy(m_mapping.data + m_position, data.data(), data.size());
+    m_position += data.size();
+}
+
+void MappedFileOutput::doFlush()
+{
+    if(m_mapping.data != nullptr && m_syncedPosition < m_position)
+    {
+        const size_t syncStart = alignOnPage(m_syncedPosition);
+        syncMapping(m_mapping.data + syncStart, m_position - syncStart, false);
+    }
+}
+
+bool MappedFileOutput::mapFile(const std::string& filename, bool truncate, Mapping& mapping, size_t& dataSize) const
+{
+    const int fd = openFile(filename, truncate);
+    if(fd < 0)
+        return false;
+
+    const uintmax_t fileSize = getOpenedFileSize(fd);
+    char* data = nullptr;
+
+    if(!reserveFile(fd, m_maxFileSize) || (data = mapMemory(fd, m_maxFileSize)) == nullptr)
+    {
+        closeFile(fd);
+        return false;
+    }
+
+    // a file having the full size may not have been released, its data ends at the last non null byte
+    dataSize = static_cast<size_t>(std::min<uintmax_t>(fileSize, m_maxFileSize));
+    if(fileSize >= m_maxFileSize)
+    {
+        while(dataSize > 0 && data[dataSize - 1] == '\0')
+            dataSize--;
+    }
+
+    mapping = Mapping{fd, data};
+    return true;
+}
+
+void MappedFileOutput::releaseMapping(Mapping& mapping, size_t dataSize) const
+{
+    if(mapping.data == nullptr)
+        return;
+
+    syncMapping(mapping.data, dataSize, true);
+    unmapFile(mapping.data, m_maxFileSize);
+    truncateFile(mapping.fd, dataSize);
+    closeFile(mapping.fd);
+    mapping = Mapping{-1, nullptr};
+}
+
+void MappedFileOutput::open()
+{
+#ifdef _WIN32
+    throw std::runtime_error("Memory mapped log files are not supported on this system");
+#endif
+
+    m_fileNames.recover();
+
+    // an existing file larger than the files of this output is rolled rather than continued
+    std::error_code error;
+    const uintmax_t existingSize = std::filesystem::file_size(m_fileNames.getFirst(), error);
+    if(!error && existingSize > m_maxFileSize)
+        m_fileNames.shift();
+
+    if(!mapFile(m_fileNames.getFirst(), false, m_mapping, m_position))
+        throw std::runtime_error("Failed to map file '" + m_fileNames.getFirst() + "' in memory: " + std::strerror(errno));
+    m_syncedPosition = m_position;
+
+    size_t nextDataSize;
+    if(!mapFile(m_fileNames.getNext(), true, m_nextMapping, nextDataSize))
+    {
+        releaseMapping(m_mapping, m_position);
+        throw std::runtime_error("Failed to map file '" + m_fileNames.getNext() + "' in memory: " + std::strerror(errno));
+    }
+}
+
+void MappedFileOutput::roll()
+{
+    m_metrics.countRoll();
+
+    const Mapping previous = m_mapping;
+    const size_t previousSize = m_position;
+
+    m_mapping = m_nextMapping;
+    m_nextMapping = Mapping{-1, nullptr};
+    m_nextFileInUse = true;
+    m_position = 0;
+    m_syncedPosition = 0;
+    m_rollCount++;
+
+    prepareNextFile(previous, previousSize);
+
+    // the previous file becomes the file with index 1 in the task above, the compression is done after it
+    if(m_compressRolledFiles)
+        internal::FileMaintenance::getInstance().post([fileNames = m_fileNames]() { fileNames.compress(1); });
+}
+
+void MappedFileOutput::prepareNextFile(Mapping previous, size_t previousSize)
+{
+    m_nextFilePreparation = internal::FileMaintenance::getInstance().post([this, previous, previousSize]() mutable
+    {
+        {
+            std::unique_lock<std::mutex> syncLock(m_syncMutex);
+            m_syncCondition.wait(syncLock, [this]() { return m_syncCount == 0; });
+        }
+        releaseMapping(previous, previousSize);
+
+        if(m_nextFileInUse)
+        {
+            m_fileNames.promoteNext();
+            m_nextFileInUse = false;
+        }
+
+        size_t nextDataSize;
+        mapFile(m_fileNames.getNext(), true, m_nextMapping, nextDataSize);
+    });
+}
+
+bool MappedFileOutput::waitNextFile()
+{
+    if(m_nextFilePreparation.valid())
+        m_nextFilePreparation.wait();
+
+    // the preparation failed, try again
+    if(m_nextFileInUse || m_nextMapping.data == nullptr)
+    {
+        prepareNextFile(Mapping{-1, nullptr}, 0);
+        m_nextFilePreparation.wait();
+    }
+
+    return !m_nextFileInUse && m_nextMapping.data != nullptr;
+}
+
+}
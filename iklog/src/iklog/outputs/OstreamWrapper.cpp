@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, InternationalKoder
+    Copyright (C) 2019, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -29,4 +29,10 @@ namespace iklog
     OstreamWrapper::OstreamWrapper(std::ostream& ostream) :
         m_ostream(&ostream)
     {}
+
+    OstreamWrapper::~OstreamWrapper()
+    {
+        stopPeriodicFlush();
+        m_ostream->flush();
+    }
 }
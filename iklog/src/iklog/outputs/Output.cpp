@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, 2023, InternationalKoder
+    Copyright (C) 2019, 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -18,16 +18,79 @@
 */
 
 #include "iklog/outputs/Output.hpp"
+#include "FlushTicker.hpp"
 
 namespace iklog
 {
 
-Output::Output() = default;
-Output::~Output() = default;
+Output::Output() :
+    m_flushPolicy(FlushPolicy::everyMessage()),
+    m_pendingMessages(0),
+    m_pendingBytes(0),
+    m_periodicFlush(false)
+{}
 
-std::ostream& operator<<(Output& output, const std::string& message)
+Output::~Output()
 {
-    return output.write(message);
+    stopPeriodicFlush();
+}
+
+void Output::write(const Message& message, std::string_view formatted)
+{
+    const OutputMetrics::WriteScope metricsScope(m_metrics, formatted.size());
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    doWrite(formatted);
+
+    m_pendingMessages++;
+    m_pendingBytes += formatted.size();
+
+    if(m_flushPolicy.shouldFlush(m_pendingMessages, m_pendingBytes, message.getLevel()))
+    {
+        doFlush();
+        m_metrics.countFlush();
+        m_pendingMessages = 0;
+        m_pendingBytes = 0;
+    }
+}
+
+void Output::flush()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if(m_pendingMessages == 0)
+        return;
+
+    doFlush();
+    m_metrics.countFlush();
+    m_pendingMessages = 0;
+    m_pendingBytes = 0;
+}
+
+void Output::setFlushPolicy(const FlushPolicy& flushPolicy)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_flushPolicy = flushPolicy;
+    }
+
+    // the flush ticker locks the output when flushing, so the output must not be locked while (un)registering
+    if(flushPolicy.isPeriodic())
+    {
+        internal::FlushTicker::getInstance().add(*this, flushPolicy.getInterval());
+        m_periodicFlush = true;
+    }
+    else
+        stopPeriodicFlush();
+}
+
+void Output::stopPeriodicFlush()
+{
+    if(m_periodicFlush)
+    {
+        internal::FlushTicker::getInstance().remove(*this);
+        m_periodicFlush = false;
+    }
 }
 
 }
@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2019, 2023, InternationalKoder
+    Copyright (C) 2019, 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -18,6 +18,7 @@
 */
 
 #include "iklog/outputs/RollingFileOutput.hpp"
+#include "iklog/files/FileMaintenance.hpp"
 #include <filesystem>
 #include <string>
 
@@ -44,50 +45,136 @@ RollingFileOutput::RollingFileOutput(const std::string& baseFilename, const Giga
     RollingFileOutput(baseFilename, maxRollingFiles, maxFileSize)
 {}
 
-RollingFileOutput::~RollingFileOutput() = default;
+RollingFileOutput::~RollingFileOutput()
+{
+    stopPeriodicFlush();
+
+    if(m_nextFilePreparation.valid())
+        m_nextFilePreparation.wait();
+
+    // the unused next file is removed, but if we write to it, it is kept to be promoted at the next start
+    m_nextFile.close();
+    if(!m_nextFileInUse)
+    {
+        std::error_code error;
+        std::filesystem::remove(m_fileNames.getNext(), error);
+    }
+}
+
+void RollingFileOutput::setRolledFilesCompression(bool compress)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_compressRolledFiles = compress;
+}
+
+bool RollingFileOutput::isCompressingRolledFiles()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_compressRolledFiles;
+}
 
-std::ostream& RollingFileOutput::write(const std::string& message)
+void RollingFileOutput::doWrite(std::string_view data)
 {
-    // update cache with estimated file size (+ line ending)
-    m_fileSizeCache += message.length() + 2;
+    // update cache with estimated file size
+    m_fileSizeCache += data.length();
 
     // if necessary, update cache with actual file size
     if(m_fileSizeCache > m_cacheValidityThreshold)
     {
-        m_fileSizeCache = std::filesystem::file_size(m_firstRollingFileName);
+        const std::streamoff position = m_file.tellp();
+        if(position >= 0)
+            m_fileSizeCache = static_cast<uintmax_t>(position) + data.length();
         m_cacheValidityThreshold = (m_fileSizeCache + m_maxFileSize) / 2;
     }
 
     // if the file is too large, do the rolling
-    if(m_fileSizeCache >= m_maxFileSize)
+    if(m_fileSizeCache >= m_maxFileSize && isNextFileReady())
         roll();
 
-    return m_file << message;
+    m_file.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+void RollingFileOutput::doFlush()
+{
+    m_file.flush();
+}
+
+void RollingFileOutput::open()
+{
+    m_fileNames.recover();
+
+    m_file.open(m_fileNames.getFirst(), std::ios::out | std::ios::app);
+    if(!m_file.is_open())
+        throw std::runtime_error("Failed to open file '" + m_fileNames.getFirst() + "' in write mode");
+
+#ifndef _WIN32
+    m_nextFile.open(m_fileNames.getNext(), std::ios::out | std::ios::trunc);
+    if(!m_nextFile.is_open())
+        throw std::runtime_error("Failed to open file '" + m_fileNames.getNext() + "' in write mode");
+#endif
 }
 
 void RollingFileOutput::roll()
 {
-    // if the last file of the rolling system exists, then we have to remove it
-    if(std::filesystem::exists(m_lastRollingFileName))
-        std::filesystem::remove(m_lastRollingFileName);
+    m_metrics.countRoll();
 
+#ifdef _WIN32
+    // open files cannot be renamed on Windows, so the rolling is done here
     m_file.close();
+    m_fileNames.shift();
+    m_file.open(m_fileNames.getFirst(), std::ios::out | std::ios::trunc);
+#else
+    std::swap(m_file, m_nextFile);
+    m_nextFileInUse = true;
+#endif
+
+    // reset cache, the new file is empty
+    m_fileSizeCache = 0;
+    m_cacheValidityThreshold = m_maxFileSize / 2;
+
+#ifndef _WIN32
+    prepareNextFile();
+#endif
+
+    // the previous file becomes the file with index 1 in the task above, the compression is done after it
+    if(m_compressRolledFiles)
+        internal::FileMaintenance::getInstance().post([fileNames = m_fileNames]() { fileNames.compress(1); });
+}
 
-    // roll the files if they exist
-    for(int roll = static_cast<int>(m_maxRoll) - 1 ; roll >= 0 ; roll--)
+void RollingFileOutput::prepareNextFile()
+{
+    m_nextFilePreparation = internal::FileMaintenance::getInstance().post([this]()
     {
-        const std::string fileToRoll = m_baseFilenameSep + std::to_string(roll);
+        m_nextFile.close();
 
-        if(std::filesystem::exists(fileToRoll))
-            std::filesystem::rename(fileToRoll, m_baseFilenameSep + std::to_string(roll + 1));
-    }
+        if(m_nextFileInUse)
+        {
+            m_fileNames.promoteNext();
+            m_nextFileInUse = false;
+        }
 
-    // reset cache
-    m_fileSizeCache = 0;
-    m_cacheValidityThreshold = 0;
+        m_nextFile.open(m_fileNames.getNext(), std::ios::out | std::ios::trunc);
+    });
+}
+
+bool RollingFileOutput::isNextFileReady()
+{
+#ifdef _WIN32
+    return true;
+#else
+    if(m_nextFilePreparation.valid() &&
+       m_nextFilePreparation.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+
+    // the preparation failed, try again
+    if(m_nextFileInUse || !m_nextFile.is_open())
+    {
+        prepareNextFile();
+        return false;
+    }
 
-    // open new file
-    m_file.open(m_firstRollingFileName);
+    return true;
+#endif
 }
 
 }
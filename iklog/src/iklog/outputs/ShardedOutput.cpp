@@ -0,0 +1,216 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklog/outputs/ShardedOutput.hpp"
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+namespace iklog
+{
+
+namespace
+{
+    /*!
+     * \brief Gives a new identifier for a ShardedOutput, never reused so that a thread cannot confuse two instances
+     */
+    uint64_t getNextId()
+    {
+        static std::atomic<uint64_t> nextId = 0;
+        return nextId.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+ShardedOutput::ThreadShards::~ThreadShards()
+{
+    for(auto& [id, shard] : shards)
+        shard->abandoned.store(true, std::memory_order_release);
+}
+
+ShardedOutput::ShardedOutput(Output& output, size_t shardCapacity, std::chrono::milliseconds drainInterval) :
+    iklog::Output(),
+    m_output(output),
+    m_id(getNextId()),
+    m_shardCapacity(std::max<size_t>(shardCapacity, 1)),
+    m_drainInterval(drainInterval),
+    m_running(true),
+    m_thread(&ShardedOutput::run, this)
+{}
+
+ShardedOutput::~ShardedOutput()
+{
+    stopPeriodicFlush();
+
+    {
+        std::lock_guard<std::mutex> lock(m_threadMutex);
+        m_running = false;
+    }
+
+    m_condVar.notify_one();
+    m_thread.join();
+
+    // the drain thread wrote the remaining messages, the threads can now forget their shards
+    std::lock_guard<std::mutex> lock(m_shardsMutex);
+    for(const std::shared_ptr<Shard>& shard : m_shards)
+        shard->abandoned.store(true, std::memory_order_release);
+}
+
+void ShardedOutput::write(const Message& message, std::string_view formatted)
+{
+    const OutputMetrics::WriteScope metricsScope(m_metrics, formatted.size());
+    append(message.getClockTime(), message.getLevel(), formatted);
+}
+
+void ShardedOutput::flush()
+{
+    drain();
+    m_output.flush();
+    m_metrics.countFlush();
+}
+
+void ShardedOutput::doWrite(std::string_view data)
+{
+    append(std::chrono::system_clock::now(), Level::DEBUG, data);
+}
+
+void ShardedOutput::doFlush()
+{
+    drain();
+}
+
+ShardedOutput::Shard& ShardedOutput::getThreadShard()
+{
+    thread_local ThreadShards threadShards;
+
+    for(auto& [id, shard] : threadShards.shards)
+    {
+        if(id == m_id)
+            return *shard;
+    }
+
+    // forget the shards of the destroyed outputs, before adding the new one
+    std::erase_if(threadShards.shards, [](const auto& entry) { return entry.second->abandoned.load(std::memory_order_acquire); });
+
+    auto shard = std::make_shared<Shard>();
+
+    {
+        std::lock_guard<std::mutex> lock(m_shardsMutex);
+        m_shards.push_back(shard);
+    }
+
+    threadShards.shards.emplace_back(m_id, shard);
+    return *shard;
+}
+
+void ShardedOutput::append(const Message::TimePoint& clockTime, Level level, std::string_view formatted)
+{
+    Shard& shard = getThreadShard();
+    std::unique_lock<std::mutex> lock(shard.mutex);
+
+    // wait for the drain thread to make room, a single message larger than the shard is accepted in an empty shard
+    if(!shard.data.empty() && shard.data.size() + formatted.size() > m_shardCapacity)
+    {
+        m_condVar.notify_one();
+        shard.drained.wait(lock, [this, &shard, &formatted]()
+        {
+            return shard.data.empty() || shard.data.size() + formatted.size() <= m_shardCapacity;
+        });
+    }
+
+    shard.entries.push_back(Entry{clockTime, level, shard.data.size(), formatted.size()});
+    shard.data.append(formatted);
+}
+
+void ShardedOutput::drain()
+{
+    std::lock_guard<std::mutex> shardsLock(m_shardsMutex);
+
+    // take the messages of all the shards, the threads can then continue logging while they are written
+    for(const std::shared_ptr<Shard>& shard : m_shards)
+    {
+        {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->drainingData.swap(shard->data);
+            shard->drainingEntries.swap(shard->entries);
+        }
+
+        shard->drained.notify_all();
+    }
+
+    // merge the messages by timestamp: each shard is already ordered, so only the first message of each one is compared
+    using Head = std::pair<Message::TimePoint, size_t>; // time of the next message of a shard, index of the shard
+    std::priority_queue<Head, std::vector<Head>, std::greater<Head>> heads;
+    std::vector<size_t> nextEntries(m_shards.size(), 0);
+
+    for(size_t shardIndex = 0 ; shardIndex < m_shards.size() ; shardIndex++)
+    {
+        if(!m_shards[shardIndex]->drainingEntries.empty())
+            heads.emplace(m_shards[shardIndex]->drainingEntries.front().clockTime, shardIndex);
+    }
+
+    while(!heads.empty())
+    {
+        const size_t shardIndex = heads.top().second;
+        heads.pop();
+
+        Shard& shard = *m_shards[shardIndex];
+        const Entry& entry = shard.drainingEntries[nextEntries[shardIndex]++];
+
+        m_output.write(Message(std::string_view(), entry.level, std::string_view(), Message::Duration::zero(), entry.clockTime),
+                       std::string_view(shard.drainingData).substr(entry.offset, entry.length));
+
+        if(nextEntries[shardIndex] < shard.drainingEntries.size())
+            heads.emplace(shard.drainingEntries[nextEntries[shardIndex]].clockTime, shardIndex);
+    }
+
+    for(const std::shared_ptr<Shard>& shard : m_shards)
+    {
+        shard->drainingData.clear();
+        shard->drainingEntries.clear();
+    }
+
+    // the shards of the exited threads are removed once they are empty
+    std::erase_if(m_shards, [](const std::shared_ptr<Shard>& shard)
+    {
+        if(!shard->abandoned.load(std::memory_order_acquire))
+            return false;
+
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        return shard->entries.empty();
+    });
+}
+
+void ShardedOutput::run()
+{
+    std::unique_lock<std::mutex> lock(m_threadMutex);
+
+    while(m_running)
+    {
+        m_condVar.wait_for(lock, m_drainInterval);
+
+        lock.unlock();
+        drain();
+        lock.lock();
+    }
+
+    lock.unlock();
+    drain();
+}
+
+}
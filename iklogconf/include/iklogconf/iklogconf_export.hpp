@@ -0,0 +1,42 @@
+
+#ifndef IKLOGCONF_EXPORT_H
+#define IKLOGCONF_EXPORT_H
+
+#ifdef IKLOGCONF_BUILT_AS_STATIC
+#  define IKLOGCONF_EXPORT
+#  define IKLOGCONF_NO_EXPORT
+#else
+#  ifndef IKLOGCONF_EXPORT
+#    ifdef iklogconf_EXPORTS
+        /* We are building this library */
+#      define IKLOGCONF_EXPORT __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define IKLOGCONF_EXPORT __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef IKLOGCONF_NO_EXPORT
+#    define IKLOGCONF_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef IKLOGCONF_DEPRECATED
+#  define IKLOGCONF_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef IKLOGCONF_DEPRECATED_EXPORT
+#  define IKLOGCONF_DEPRECATED_EXPORT IKLOGCONF_EXPORT IKLOGCONF_DEPRECATED
+#endif
+
+#ifndef IKLOGCONF_DEPRECATED_NO_EXPORT
+#  define IKLOGCONF_DEPRECATED_NO_EXPORT IKLOGCONF_NO_EXPORT IKLOGCONF_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef IKLOGCONF_NO_DEPRECATED
+#    define IKLOGCONF_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* IKLOGCONF_EXPORT_H */
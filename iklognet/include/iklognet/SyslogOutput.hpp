@@ -0,0 +1,202 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOGNET_SYSLOG_OUTPUT_HPP
+#define IKLOGNET_SYSLOG_OUTPUT_HPP
+
+#include <iklog/outputs/Output.hpp>
+#include <iknet/AddrInfo.hpp>
+#include <iknet/UdpSocket.hpp>
+#include <ikgen/Result.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "iklognet_export.hpp"
+
+namespace iklognet
+{
+
+/*!
+ * \brief Output sending the formatted messages to a syslog collector, as RFC 5424 messages in UDP datagrams
+ *
+ * The destination is resolved once, when the output is created. Writing a message only adds its syslog record to a buffer:
+ * a dedicated thread sends the buffered records at each send interval, or as soon as they fill a datagram.
+ * The records are packed in datagrams of at most the maximum datagram size, each one ending with a line feed, so the
+ * collector has to split the datagrams into lines. Packing can be disabled to send one record per datagram, as described
+ * by RFC 5426.
+ *
+ * The level of a message gives its syslog severity, its log name gives the MSGID field. When the buffer is full,
+ * or when a datagram cannot be sent, the messages are dropped and counted
+ */
+class SyslogOutput : public iklog::Output
+{
+    public:
+
+        /*!
+         * \brief Syslog facilities, as defined by RFC 5424
+         */
+        enum class Facility
+        {
+            KERNEL = 0,
+            USER = 1,
+            MAIL = 2,
+            DAEMON = 3,
+            AUTH = 4,
+            SYSLOG = 5,
+            LPR = 6,
+            NEWS = 7,
+            UUCP = 8,
+            CRON = 9,
+            AUTHPRIV = 10,
+            FTP = 11,
+            LOCAL0 = 16,
+            LOCAL1 = 17,
+            LOCAL2 = 18,
+            LOCAL3 = 19,
+            LOCAL4 = 20,
+            LOCAL5 = 21,
+            LOCAL6 = 22,
+            LOCAL7 = 23
+        };
+
+
+        static constexpr uint16_t DEFAULT_PORT = 514; //! default port of syslog collectors
+        static constexpr size_t DEFAULT_MAX_DATAGRAM_SIZE = 1472; //! default maximum size of a datagram, an Ethernet MTU minus the IP and UDP headers
+        static constexpr size_t MIN_DATAGRAM_SIZE = 480; //! smallest maximum size of a datagram, which every collector accepts and which holds any record header
+        static constexpr size_t DEFAULT_BUFFER_CAPACITY = 1024 * 1024; //! default size of the buffer of records waiting to be sent, in bytes
+        static constexpr std::chrono::milliseconds DEFAULT_SEND_INTERVAL{100}; //! default maximum time before a record is sent
+
+
+        /*!
+         * \brief Creates a new instance of SyslogOutput. Same as constructor but returns a Result
+         * \param host The host name or address of the collector
+         * \param port The UDP port of the collector
+         * \param appName The APP-NAME field of the records
+         * \param facility The facility of the records
+         * \return Either the newly created SyslogOutput in case of success, or an error message otherwise
+         */
+        IKLOGNET_EXPORT static ikgen::Result<SyslogOutput, std::string> create(const std::string& host, uint16_t port = DEFAULT_PORT,
+                                                                               const std::string& appName = "",
+                                                                               Facility facility = Facility::USER);
+
+        /*!
+         * \brief Constructor, throws std::runtime_error if the destination cannot be resolved or the socket cannot be created
+         * \param host The host name or address of the collector
+         * \param port The UDP port of the collector
+         * \param appName The APP-NAME field of the records
+         * \param facility The facility of the records
+         * \param maxDatagramSize The maximum size of a datagram, a longer record is truncated, raised to MIN_DATAGRAM_SIZE if smaller
+         * \param bufferCapacity The size of the buffer of records waiting to be sent, the messages are dropped when it is full
+         * \param sendInterval The maximum time before a record is sent
+         * \param packRecords True to send several records per datagram, false to send one record per datagram
+         */
+        IKLOGNET_EXPORT SyslogOutput(const std::string& host, uint16_t port = DEFAULT_PORT, const std::string& appName = "",
+                                     Facility facility = Facility::USER, size_t maxDatagramSize = DEFAULT_MAX_DATAGRAM_SIZE,
+                                     size_t bufferCapacity = DEFAULT_BUFFER_CAPACITY,
+                                     std::chrono::milliseconds sendInterval = DEFAULT_SEND_INTERVAL, bool packRecords = true);
+
+        /*!
+         * \brief Destructor, sends the remaining records then stops the sending thread
+         */
+        IKLOGNET_EXPORT virtual ~SyslogOutput();
+
+        /*!
+         * \brief Adds the syslog record of a formatted message to the buffer of records to send
+         * \param message The message that has been formatted
+         * \param formatted The formatted message, including its line ending
+         */
+        IKLOGNET_EXPORT virtual void write(const iklog::Message& message, std::string_view formatted) override;
+
+        /*!
+         * \brief Sends the buffered records
+         */
+        IKLOGNET_EXPORT virtual void flush() override;
+
+
+        /*!
+         * \brief Gives the number of messages dropped because the buffer was full or their datagram could not be sent
+         * \return The number of dropped messages
+         */
+        inline uint64_t getDroppedCount() const { return m_metrics.getDroppedCount(); }
+
+    protected:
+
+        /*!
+         * \brief Adds data to the buffer of records to send, as a message logged now in the lowest level
+         * \param data The data to write
+         */
+        IKLOGNET_EXPORT virtual void doWrite(std::string_view data) override;
+
+        /*!
+         * \brief Wakes the sending thread up, called with the mutex locked
+         */
+        IKLOGNET_EXPORT virtual void doFlush() override;
+
+    private:
+
+        /*!
+         * \brief Adds the syslog record of a message to the buffer, called with the mutex locked
+         * \param message The message
+         * \param formatted The formatted message
+         */
+        void appendRecord(const iklog::Message& message, std::string_view formatted);
+
+        /*!
+         * \brief Sends the buffered records, packed in datagrams
+         */
+        void sendRecords();
+
+        /*!
+         * \brief Runs the sending thread
+         */
+        void run();
+
+
+        iknet::AddrInfo m_destination; // resolved address of the collector
+        iknet::UdpSocket m_socket;
+        const std::string m_headerFields; // HOSTNAME and APP-NAME fields, shared by all the records
+        const std::string m_processId; // PROCID field
+        const int m_facility;
+        const size_t m_maxDatagramSize;
+        const size_t m_bufferCapacity;
+        const std::chrono::milliseconds m_sendInterval;
+        const bool m_packRecords;
+
+        std::string m_records; // records waiting to be sent, protected by the mutex of the output
+        std::vector<size_t> m_recordEnds; // end of each record in m_records
+
+        std::mutex m_sendMutex; // protects the socket and the records being sent
+        std::string m_sendingRecords; // records being sent
+        std::vector<size_t> m_sendingRecordEnds; // end of each record being sent
+        std::string m_datagram; // datagram being filled
+
+
+        std::mutex m_threadMutex; // protects the running state of the sending thread
+        std::condition_variable m_condVar; // wakes the sending thread up when a datagram is full or the output is destroyed
+        bool m_running;
+        std::thread m_thread;
+};
+
+}
+
+#endif // IKLOGNET_SYSLOG_OUTPUT_HPP
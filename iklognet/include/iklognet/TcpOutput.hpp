@@ -0,0 +1,233 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLOGNET_TCP_OUTPUT_HPP
+#define IKLOGNET_TCP_OUTPUT_HPP
+
+#include <iklog/outputs/Output.hpp>
+#include <iknet/TcpSocket.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "iklognet_export.hpp"
+
+namespace iklognet
+{
+
+/*!
+ * \brief Output streaming the formatted messages to a log collector over TCP
+ *
+ * Writing a message only copies it to a bounded in-memory spool. A dedicated thread connects to the collector,
+ * and sends the whole spool at once at each send interval, or as soon as it holds a batch. When the connection fails,
+ * the thread reconnects after a delay doubling at each failed attempt, up to a maximum. The messages that could not
+ * be sent are sent again after the reconnection, from the beginning of the first message that was not entirely sent.
+ *
+ * Only the overflow policy can make a logging thread wait, when the spool is full, and at most for the send timeout:
+ * a collector being slow or unreachable only delays the sending thread. Connections and sendings time out after the send timeout,
+ * the connection is then considered as lost. As there is no acknowledgment from the collector, the messages accepted by the system just before
+ * a connection loss is detected can be lost
+ */
+class TcpOutput : public iklog::Output
+{
+    public:
+
+        /*!
+         * \brief What to do with a message written when the spool is full
+         */
+        enum class OverflowPolicy
+        {
+            BLOCK,        //! the logging thread waits until the sending thread makes room, the message is dropped after the send timeout
+            DROP_NEWEST,  //! the new message is dropped
+            DROP_OLDEST   //! the oldest messages of the spool are dropped to make room for the new one
+        };
+
+
+        static constexpr size_t DEFAULT_SPOOL_CAPACITY = 4 * 1024 * 1024; //! default size of the spool, in bytes
+        static constexpr size_t DEFAULT_BATCH_SIZE = 64 * 1024; //! default amount of data waking the sending thread up, in bytes
+        static constexpr std::chrono::milliseconds DEFAULT_SEND_INTERVAL{100}; //! default maximum time before a message is sent
+        static constexpr std::chrono::milliseconds DEFAULT_MIN_RECONNECT_DELAY{100}; //! default delay before the first reconnection attempt
+        static constexpr std::chrono::milliseconds DEFAULT_MAX_RECONNECT_DELAY{30000}; //! default maximum delay between two reconnection attempts
+        static constexpr std::chrono::milliseconds DEFAULT_SEND_TIMEOUT{5000}; //! default maximum time a sending can be blocked by the collector
+
+
+        /*!
+         * \brief Constructor, the connection is made by the sending thread, so a collector that is not reachable yet is not an error
+         * \param host The host name or address of the collector, resolved at each connection
+         * \param port The TCP port of the collector
+         * \param spoolCapacity The size of the spool in bytes, including the batch being sent
+         * \param overflowPolicy What to do with a message written when the spool is full
+         */
+        IKLOGNET_EXPORT TcpOutput(const std::string& host, uint16_t port, size_t spoolCapacity = DEFAULT_SPOOL_CAPACITY,
+                                  OverflowPolicy overflowPolicy = OverflowPolicy::DROP_NEWEST);
+
+        /*!
+         * \brief Destructor, tries to send the remaining messages if connected, then stops the sending thread
+         *
+         * The messages that could not be sent are counted as dropped. Waits at most for a connection or a sending in progress,
+         * each bounded by the send timeout
+         */
+        IKLOGNET_EXPORT virtual ~TcpOutput();
+
+        /*!
+         * \brief Copies a formatted message to the spool, applying the overflow policy if it is full
+         * \param message The message that has been formatted
+         * \param formatted The formatted message, including its line ending
+         */
+        IKLOGNET_EXPORT virtual void write(const iklog::Message& message, std::string_view formatted) override;
+
+        /*!
+         * \brief Wakes the sending thread up, without waiting for the messages to be sent
+         */
+        IKLOGNET_EXPORT virtual void flush() override;
+
+
+        /*!
+         * \brief Changes the reconnection delays, the delay doubles after each failed attempt
+         * \param minDelay The delay before the first reconnection attempt
+         * \param maxDelay The maximum delay between two attempts
+         */
+        IKLOGNET_EXPORT void setReconnectDelays(std::chrono::milliseconds minDelay, std::chrono::milliseconds maxDelay);
+
+        /*!
+         * \brief Changes the batching of the messages
+         * \param batchSize The amount of data waking the sending thread up, in bytes
+         * \param sendInterval The maximum time before a message is sent
+         */
+        IKLOGNET_EXPORT void setBatching(size_t batchSize, std::chrono::milliseconds sendInterval);
+
+        /*!
+         * \brief Changes the maximum time a sending can be blocked by the collector, applied from the next connection
+         *
+         * It is also the maximum time a logging thread waits for room in the spool with the blocking overflow policy
+         * \param sendTimeout The maximum time
+         */
+        IKLOGNET_EXPORT void setSendTimeout(std::chrono::milliseconds sendTimeout);
+
+
+        /*!
+         * \brief Gives the number of messages dropped because of the overflow policy, or because they were larger than the spool
+         * \return The number of dropped messages
+         */
+        inline uint64_t getDroppedCount() const { return m_metrics.getDroppedCount(); }
+
+        /*!
+         * \brief Tells whether the output is currently connected to the collector
+         * \return True if connected
+         */
+        inline bool isConnected() const { return m_connected.load(std::memory_order_relaxed); }
+
+    protected:
+
+        /*!
+         * \brief Copies data to the spool, as a message logged now in the lowest level
+         * \param data The data to write
+         */
+        IKLOGNET_EXPORT virtual void doWrite(std::string_view data) override;
+
+        /*!
+         * \brief Wakes the sending thread up, called with the mutex locked
+         */
+        IKLOGNET_EXPORT virtual void doFlush() override;
+
+    private:
+
+        /*!
+         * \brief Copies data to the spool, called with the mutex locked
+         * \param lock The lock of the mutex, released while waiting for room with the blocking policy
+         * \param data The data to copy
+         */
+        void append(std::unique_lock<std::mutex>& lock, std::string_view data);
+
+        /*!
+         * \brief Wakes the sending thread up to send the spool now
+         *
+         * May be called with the mutex of the output locked, which is never locked while holding the thread mutex
+         */
+        void requestSend();
+
+        /*!
+         * \brief Tries to connect to the collector
+         * \param sendTimeout The maximum time a sending can be blocked on the new connection
+         * \return True if connected
+         */
+        bool connect(std::chrono::milliseconds sendTimeout);
+
+        /*!
+         * \brief Closes the connection to the collector
+         */
+        void disconnect();
+
+        /*!
+         * \brief Sends the batch being sent if there is one, then the content of the spool
+         * \return False if the connection has been lost
+         */
+        bool sendSpool();
+
+        /*!
+         * \brief Sends the batch being sent, from the first message that has not been entirely sent
+         * \return False if the connection has been lost
+         */
+        bool sendBatch();
+
+        /*!
+         * \brief Runs the sending thread
+         */
+        void run();
+
+
+        const std::string m_host;
+        const uint16_t m_port;
+        const size_t m_spoolCapacity;
+        const OverflowPolicy m_overflowPolicy;
+
+        std::string m_spool; // messages waiting to be sent, from m_spoolStart, protected by the mutex of the output
+        size_t m_spoolStart; // beginning of the oldest message in the spool
+        std::deque<size_t> m_spoolMessageSizes; // size of each message of the spool
+        size_t m_batchLength; // size of the batch being sent, counted in the capacity of the spool
+        std::condition_variable m_spoolRoom; // wakes the blocked logging threads up when the spool or the batch has been emptied
+
+        std::unique_ptr<iknet::TcpSocket> m_socket; // connection to the collector, only used by the sending thread
+        std::string m_batch; // messages being sent
+        std::vector<size_t> m_batchMessageEnds; // end of each message in the batch
+        size_t m_batchSentMessages; // number of messages of the batch that have been entirely sent
+
+        std::atomic<size_t> m_batchSize; // amount of data waking the sending thread up
+        std::atomic<bool> m_connected;
+
+        std::mutex m_threadMutex; // protects the settings and the running state of the sending thread
+        std::condition_variable m_condVar; // wakes the sending thread up when a batch is ready or the output is destroyed
+        std::chrono::milliseconds m_minReconnectDelay;
+        std::chrono::milliseconds m_maxReconnectDelay;
+        std::chrono::milliseconds m_sendInterval;
+        std::chrono::milliseconds m_sendTimeout;
+        bool m_sendRequested; // whether the spool has to be sent without waiting for the send interval
+        bool m_running;
+        std::thread m_thread;
+};
+
+}
+
+#endif // IKLOGNET_TCP_OUTPUT_HPP
@@ -0,0 +1,42 @@
+
+#ifndef IKLOGNET_EXPORT_H
+#define IKLOGNET_EXPORT_H
+
+#ifdef IKLOGNET_BUILT_AS_STATIC
+#  define IKLOGNET_EXPORT
+#  define IKLOGNET_NO_EXPORT
+#else
+#  ifndef IKLOGNET_EXPORT
+#    ifdef iklognet_EXPORTS
+        /* We are building this library */
+#      define IKLOGNET_EXPORT __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define IKLOGNET_EXPORT __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef IKLOGNET_NO_EXPORT
+#    define IKLOGNET_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef IKLOGNET_DEPRECATED
+#  define IKLOGNET_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef IKLOGNET_DEPRECATED_EXPORT
+#  define IKLOGNET_DEPRECATED_EXPORT IKLOGNET_EXPORT IKLOGNET_DEPRECATED
+#endif
+
+#ifndef IKLOGNET_DEPRECATED_NO_EXPORT
+#  define IKLOGNET_DEPRECATED_NO_EXPORT IKLOGNET_NO_EXPORT IKLOGNET_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef IKLOGNET_NO_DEPRECATED
+#    define IKLOGNET_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* IKLOGNET_EXPORT_H */
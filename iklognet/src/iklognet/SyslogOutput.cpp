@@ -0,0 +1,300 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklognet/SyslogOutput.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+
+#ifdef _WIN32
+    #include <process.h>
+#else
+    #include <netdb.h>
+    #include <unistd.h>
+#endif
+
+namespace iklognet
+{
+
+namespace
+{
+    constexpr size_t MAX_HOSTNAME_LENGTH = 255;
+    constexpr size_t MAX_APP_NAME_LENGTH = 48;
+    constexpr size_t MAX_MSGID_LENGTH = 32;
+
+    // <PRI>1 TIMESTAMP HOSTNAME APP-NAME PROCID MSGID - with the longest fields, so that truncating a record keeps its header
+    constexpr size_t MAX_HEADER_LENGTH = 5 + 2 + 27 + 1 + MAX_HOSTNAME_LENGTH + 1 + MAX_APP_NAME_LENGTH + 1 + 11 + 1 + MAX_MSGID_LENGTH + 3;
+    static_assert(SyslogOutput::MIN_DATAGRAM_SIZE > MAX_HEADER_LENGTH);
+
+    /*!
+     * \brief Appends a header field of a record, which has to be printable ASCII without spaces, "-" if it is empty
+     */
+    void appendHeaderField(std::string& record, std::string_view value, size_t maxLength)
+    {
+        if(value.empty())
+        {
+            record += '-';
+            return;
+        }
+
+        value = value.substr(0, maxLength);
+        for(char c : value)
+            record += (c > ' ' && c <= '~') ? c : '_';
+    }
+
+    std::string getHostName()
+    {
+        char hostName[MAX_HOSTNAME_LENGTH + 1] = {};
+        if(gethostname(hostName, MAX_HOSTNAME_LENGTH) != 0)
+            return "";
+
+        return std::string(hostName);
+    }
+
+    int getProcessId()
+    {
+#ifdef _WIN32
+        return _getpid();
+#else
+        return static_cast<int>(getpid());
+#endif
+    }
+
+    std::string buildHeaderFields(const std::string& appName)
+    {
+        std::string fields;
+        appendHeaderField(fields, getHostName(), MAX_HOSTNAME_LENGTH);
+        fields += ' ';
+        appendHeaderField(fields, appName, MAX_APP_NAME_LENGTH);
+        return fields;
+    }
+
+    int getSeverity(iklog::Level level)
+    {
+        switch(level)
+        {
+            case iklog::Level::ERROR:
+                return 3;
+            case iklog::Level::WARNING:
+                return 4;
+            case iklog::Level::INFO:
+                return 6;
+            case iklog::Level::DEBUG:
+                return 7;
+        }
+
+        return 7;
+    }
+
+    /*!
+     * \brief Appends a RFC 3339 timestamp in UTC, with microseconds
+     */
+    void appendTimestamp(std::string& record, const iklog::Message::TimePoint& clockTime)
+    {
+        const std::time_t time = std::chrono::system_clock::to_time_t(clockTime);
+        const long long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+                    clockTime.time_since_epoch() - std::chrono::duration_cast<std::chrono::seconds>(clockTime.time_since_epoch())).count();
+
+        std::tm tm;
+#ifdef _WIN32
+        gmtime_s(&tm, &time);
+#else
+        gmtime_r(&time, &tm);
+#endif
+
+        char timestamp[40];
+        const int length = std::snprintf(timestamp, sizeof(timestamp), "%04d-%02d-%02dT%02d:%02d:%02d.%06lldZ",
+                                         tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
+                                         std::max(microseconds, 0LL));
+        record.append(timestamp, static_cast<size_t>(std::max(length, 0)));
+    }
+
+    // the socket has to be bound to an address of the same family as the destination
+    const char* getAnyAddress(iknet::AddrInfo& destination)
+    {
+        return destination.getImpl()->ai_family == AF_INET6 ? "::" : "0.0.0.0";
+    }
+}
+
+ikgen::Result<SyslogOutput, std::string> SyslogOutput::create(const std::string& host, uint16_t port, const std::string& appName,
+                                                              Facility facility)
+{
+    try
+    {
+        return ikgen::Result<SyslogOutput, std::string>::makeSuccess(host, port, appName, facility);
+    }
+    catch(const std::runtime_error& e)
+    {
+        return ikgen::Result<SyslogOutput, std::string>::makeFailure(e.what());
+    }
+}
+
+SyslogOutput::SyslogOutput(const std::string& host, uint16_t port, const std::string& appName, Facility facility,
+                           size_t maxDatagramSize, size_t bufferCapacity, std::chrono::milliseconds sendInterval, bool packRecords) :
+    iklog::Output(),
+    m_destination(host, port, iknet::AddrInfo::Protocol::Udp),
+    m_socket(getAnyAddress(m_destination), 0),
+    m_headerFields(buildHeaderFields(appName)),
+    m_processId(std::to_string(getProcessId())),
+    m_facility(static_cast<int>(facility)),
+    m_maxDatagramSize(std::max(maxDatagramSize, MIN_DATAGRAM_SIZE)),
+    m_bufferCapacity(bufferCapacity),
+    m_sendInterval(sendInterval),
+    m_packRecords(packRecords),
+    m_running(true),
+    m_thread(&SyslogOutput::run, this)
+{}
+
+SyslogOutput::~SyslogOutput()
+{
+    stopPeriodicFlush();
+
+    {
+        std::lock_guard<std::mutex> lock(m_threadMutex);
+        m_running = false;
+    }
+
+    m_condVar.notify_one();
+    m_thread.join();
+}
+
+void SyslogOutput::write(const iklog::Message& message, std::string_view formatted)
+{
+    const iklog::OutputMetrics::WriteScope metricsScope(m_metrics, formatted.size());
+    std::lock_guard<std::mutex> lock(m_mutex);
+    appendRecord(message, formatted);
+}
+
+void SyslogOutput::flush()
+{
+    sendRecords();
+    m_metrics.countFlush();
+}
+
+void SyslogOutput::doWrite(std::string_view data)
+{
+    appendRecord(iklog::Message("", iklog::Level::DEBUG, "", iklog::Message::Duration::zero(), std::chrono::system_clock::now()), data);
+}
+
+void SyslogOutput::doFlush()
+{
+    m_condVar.notify_one();
+}
+
+void SyslogOutput::appendRecord(const iklog::Message& message, std::string_view formatted)
+{
+    if(m_records.size() >= m_bufferCapacity)
+    {
+        m_metrics.countDropped();
+        return;
+    }
+
+    const size_t recordStart = m_records.size();
+
+    // <PRI>VERSION TIMESTAMP HOSTNAME APP-NAME PROCID MSGID STRUCTURED-DATA MSG
+    m_records += '<';
+    m_records += std::to_string(m_facility * 8 + getSeverity(message.getLevel()));
+    m_records += ">1 ";
+    appendTimestamp(m_records, message.getClockTime());
+    m_records += ' ';
+    m_records += m_headerFields;
+    m_records += ' ';
+    m_records += m_processId;
+    m_records += ' ';
+    appendHeaderField(m_records, message.getLogName(), MAX_MSGID_LENGTH);
+    m_records += " - ";
+
+    while(!formatted.empty() && (formatted.back() == '\n' || formatted.back() == '\r'))
+        formatted.remove_suffix(1);
+    m_records += formatted;
+
+    // a record longer than a datagram is truncated, keeping its line ending
+    if(m_records.size() - recordStart >= m_maxDatagramSize)
+        m_records.resize(recordStart + m_maxDatagramSize - 1);
+    m_records += '\n';
+
+    m_recordEnds.push_back(m_records.size());
+
+    // wake the sending thread up once a datagram can be filled
+    if(recordStart < m_maxDatagramSize && m_records.size() >= m_maxDatagramSize)
+        m_condVar.notify_one();
+}
+
+void SyslogOutput::sendRecords()
+{
+    std::lock_guard<std::mutex> sendLock(m_sendMutex);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_records.swap(m_sendingRecords);
+        m_recordEnds.swap(m_sendingRecordEnds);
+    }
+
+    size_t recordStart = 0;
+    size_t datagramRecords = 0;
+    m_datagram.clear();
+
+    const auto sendDatagram = [this, &datagramRecords]()
+    {
+        // a single record is sent without its line ending, as the collector does not need to split it
+        const size_t length = (m_packRecords || m_datagram.empty()) ? m_datagram.size() : m_datagram.size() - 1;
+        if(length > 0 && m_socket.send(m_datagram.data(), length, m_destination).isFailure())
+            m_metrics.countDropped(datagramRecords);
+
+        m_datagram.clear();
+        datagramRecords = 0;
+    };
+
+    for(size_t recordEnd : m_sendingRecordEnds)
+    {
+        const std::string_view record(m_sendingRecords.data() + recordStart, recordEnd - recordStart);
+        recordStart = recordEnd;
+
+        if(!m_datagram.empty() && (!m_packRecords || m_datagram.size() + record.size() > m_maxDatagramSize))
+            sendDatagram();
+
+        m_datagram += record;
+        datagramRecords++;
+    }
+
+    if(!m_datagram.empty())
+        sendDatagram();
+
+    m_sendingRecords.clear();
+    m_sendingRecordEnds.clear();
+}
+
+void SyslogOutput::run()
+{
+    std::unique_lock<std::mutex> lock(m_threadMutex);
+
+    while(m_running)
+    {
+        m_condVar.wait_for(lock, m_sendInterval);
+
+        lock.unlock();
+        sendRecords();
+        lock.lock();
+    }
+
+    lock.unlock();
+    sendRecords();
+}
+
+}
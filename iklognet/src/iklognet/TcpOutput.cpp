@@ -0,0 +1,334 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "iklognet/TcpOutput.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef _WIN32
+    #include <WinSock2.h>
+#else
+    #include <sys/socket.h>
+    #include <sys/time.h>
+#endif
+
+namespace iklognet
+{
+
+namespace
+{
+    void setSocketSendTimeout(iknet::TcpSocket& socket, std::chrono::milliseconds timeout)
+    {
+#ifdef _WIN32
+        const DWORD timeoutValue = static_cast<DWORD>(timeout.count());
+        setsockopt(socket.getImpl(), SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeoutValue), sizeof(timeoutValue));
+#else
+        timeval timeoutValue;
+        timeoutValue.tv_sec = static_cast<decltype(timeoutValue.tv_sec)>(timeout.count() / 1000);
+        timeoutValue.tv_usec = static_cast<decltype(timeoutValue.tv_usec)>((timeout.count() % 1000) * 1000);
+        setsockopt(socket.getImpl(), SOL_SOCKET, SO_SNDTIMEO, &timeoutValue, sizeof(timeoutValue));
+#endif
+    }
+}
+
+TcpOutput::TcpOutput(const std::string& host, uint16_t port, size_t spoolCapacity, OverflowPolicy overflowPolicy) :
+    iklog::Output(),
+    m_host(host),
+    m_port(port),
+    m_spoolCapacity(spoolCapacity),
+    m_overflowPolicy(overflowPolicy),
+    m_spoolStart(0),
+    m_batchLength(0),
+    m_batchSentMessages(0),
+    m_batchSize(DEFAULT_BATCH_SIZE),
+    m_connected(false),
+    m_minReconnectDelay(DEFAULT_MIN_RECONNECT_DELAY),
+    m_maxReconnectDelay(DEFAULT_MAX_RECONNECT_DELAY),
+    m_sendInterval(DEFAULT_SEND_INTERVAL),
+    m_sendTimeout(DEFAULT_SEND_TIMEOUT),
+    m_sendRequested(false),
+    m_running(true),
+    m_thread(&TcpOutput::run, this)
+{}
+
+TcpOutput::~TcpOutput()
+{
+    stopPeriodicFlush();
+
+    {
+        std::lock_guard<std::mutex> lock(m_threadMutex);
+        m_running = false;
+    }
+
+    m_condVar.notify_one();
+    m_thread.join();
+}
+
+void TcpOutput::write(const iklog::Message&, std::string_view formatted)
+{
+    const iklog::OutputMetrics::WriteScope metricsScope(m_metrics, formatted.size());
+    std::unique_lock<std::mutex> lock(m_mutex);
+    append(lock, formatted);
+}
+
+void TcpOutput::flush()
+{
+    requestSend();
+    m_metrics.countFlush();
+}
+
+void TcpOutput::setReconnectDelays(std::chrono::milliseconds minDelay, std::chrono::milliseconds maxDelay)
+{
+    std::lock_guard<std::mutex> lock(m_threadMutex);
+    m_minReconnectDelay = minDelay;
+    m_maxReconnectDelay = std::max(minDelay, maxDelay);
+}
+
+void TcpOutput::setBatching(size_t batchSize, std::chrono::milliseconds sendInterval)
+{
+    std::lock_guard<std::mutex> lock(m_threadMutex);
+    m_batchSize.store(batchSize, std::memory_order_relaxed);
+    m_sendInterval = sendInterval;
+}
+
+void TcpOutput::setSendTimeout(std::chrono::milliseconds sendTimeout)
+{
+    std::lock_guard<std::mutex> lock(m_threadMutex);
+    m_sendTimeout = sendTimeout;
+}
+
+void TcpOutput::doWrite(std::string_view data)
+{
+    // the mutex is already locked by the caller
+    std::unique_lock<std::mutex> lock(m_mutex, std::adopt_lock);
+    append(lock, data);
+    lock.release();
+}
+
+void TcpOutput::doFlush()
+{
+    requestSend();
+}
+
+void TcpOutput::append(std::unique_lock<std::mutex>& lock, std::string_view data)
+{
+    if(data.size() > m_spoolCapacity)
+    {
+        m_metrics.countDropped();
+        return;
+    }
+
+    std::chrono::steady_clock::time_point blockDeadline = std::chrono::steady_clock::time_point::max();
+
+    while(m_batchLength + m_spool.size() - m_spoolStart + data.size() > m_spoolCapacity)
+    {
+        switch(m_overflowPolicy)
+        {
+            case OverflowPolicy::DROP_NEWEST:
+                m_metrics.countDropped();
+                return;
+
+            case OverflowPolicy::DROP_OLDEST:
+                // the batch being sent cannot be dropped, the new message is dropped if only the batch remains
+                if(m_spoolMessageSizes.empty())
+                {
+                    m_metrics.countDropped();
+                    return;
+                }
+
+                m_spoolStart += m_spoolMessageSizes.front();
+                m_spoolMessageSizes.pop_front();
+                m_metrics.countDropped();
+                break;
+
+            case OverflowPolicy::BLOCK:
+                // a collector remaining unreachable must not block the logging threads forever
+                if(blockDeadline == std::chrono::steady_clock::time_point::max())
+                {
+                    std::lock_guard<std::mutex> threadLock(m_threadMutex);
+                    blockDeadline = std::chrono::steady_clock::now() + m_sendTimeout;
+                }
+                else if(std::chrono::steady_clock::now() >= blockDeadline)
+                {
+                    m_metrics.countDropped();
+                    return;
+                }
+
+                requestSend();
+                m_spoolRoom.wait_until(lock, blockDeadline);
+                break;
+        }
+    }
+
+    // move the messages to the beginning of the spool once enough old messages have been dropped
+    if(m_spoolStart > 0 && m_spoolStart >= m_spool.size() / 2)
+    {
+        m_spool.erase(0, m_spoolStart);
+        m_spoolStart = 0;
+    }
+
+    const size_t batchSize = m_batchSize.load(std::memory_order_relaxed);
+    const bool batchReady = m_spool.size() - m_spoolStart < batchSize;
+
+    m_spool.append(data);
+    m_spoolMessageSizes.push_back(data.size());
+
+    // wake the sending thread up once, when the spool becomes large enough for a batch
+    if(batchReady && m_spool.size() - m_spoolStart >= batchSize)
+        requestSend();
+}
+
+void TcpOutput::requestSend()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_threadMutex);
+        m_sendRequested = true;
+    }
+
+    m_condVar.notify_one();
+}
+
+bool TcpOutput::connect(std::chrono::milliseconds sendTimeout)
+{
+    try
+    {
+        // a collector dropping the connection requests must not hold the thread, nor the destructor, for minutes
+        m_socket = std::make_unique<iknet::TcpSocket>(m_host, m_port, sendTimeout);
+    }
+    catch(const std::runtime_error&)
+    {
+        return false;
+    }
+
+    setSocketSendTimeout(*m_socket, sendTimeout);
+    m_connected.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void TcpOutput::disconnect()
+{
+    m_socket.reset();
+    m_connected.store(false, std::memory_order_relaxed);
+}
+
+bool TcpOutput::sendSpool()
+{
+    if(!sendBatch())
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(m_spoolMessageSizes.empty())
+            return true;
+
+        m_spool.erase(0, m_spoolStart);
+        m_spoolStart = 0;
+        m_batch.swap(m_spool);
+        m_batchLength = m_batch.size();
+
+        size_t messageEnd = 0;
+        for(size_t messageSize : m_spoolMessageSizes)
+        {
+            messageEnd += messageSize;
+            m_batchMessageEnds.push_back(messageEnd);
+        }
+
+        m_spoolMessageSizes.clear();
+    }
+
+    return sendBatch();
+}
+
+bool TcpOutput::sendBatch()
+{
+    if(m_batch.empty())
+        return true;
+
+    size_t offset = m_batchSentMessages == 0 ? 0 : m_batchMessageEnds[m_batchSentMessages - 1];
+
+    while(offset < m_batch.size())
+    {
+        const ikgen::Result<size_t, std::string> sendResult = m_socket->send(m_batch.data() + offset, m_batch.size() - offset);
+        if(sendResult.isFailure() || sendResult.getSuccess() == 0)
+            return false;
+
+        offset += sendResult.getSuccess();
+        while(m_batchSentMessages < m_batchMessageEnds.size() && m_batchMessageEnds[m_batchSentMessages] <= offset)
+            m_batchSentMessages++;
+    }
+
+    m_batch.clear();
+    m_batchMessageEnds.clear();
+    m_batchSentMessages = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_batchLength = 0;
+    }
+
+    m_spoolRoom.notify_all();
+    return true;
+}
+
+void TcpOutput::run()
+{
+    std::unique_lock<std::mutex> lock(m_threadMutex);
+    std::chrono::milliseconds reconnectDelay = m_minReconnectDelay;
+
+    while(m_running)
+    {
+        if(m_socket == nullptr)
+        {
+            const std::chrono::milliseconds sendTimeout = m_sendTimeout;
+
+            lock.unlock();
+            const bool connected = connect(sendTimeout);
+            lock.lock();
+
+            if(!connected)
+            {
+                m_condVar.wait_for(lock, reconnectDelay, [this]() { return !m_running; });
+                reconnectDelay = std::min(reconnectDelay * 2, m_maxReconnectDelay);
+                continue;
+            }
+
+            reconnectDelay = m_minReconnectDelay;
+        }
+
+        m_condVar.wait_for(lock, m_sendInterval, [this]() { return !m_running || m_sendRequested; });
+        m_sendRequested = false;
+
+        lock.unlock();
+        if(!sendSpool())
+            disconnect();
+        lock.lock();
+    }
+
+    lock.unlock();
+
+    if(m_socket != nullptr)
+        sendSpool();
+
+    // the messages that could not be sent are lost
+    std::lock_guard<std::mutex> spoolLock(m_mutex);
+    m_metrics.countDropped(m_spoolMessageSizes.size() + m_batchMessageEnds.size() - m_batchSentMessages);
+}
+
+}
@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2023, InternationalKoder
+    Copyright (C) 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -23,6 +23,7 @@
 #include "Socket.hpp"
 #include "Buffer.hpp"
 #include "iknet_export.hpp"
+#include <chrono>
 #include <string>
 
 namespace iknet
@@ -43,6 +44,16 @@ class TcpSocket : public Socket
          */
         IKNET_EXPORT static ikgen::Result<TcpSocket, std::string> create(const std::string& remoteAddress, uint16_t remotePort);
 
+        /*!
+         * \brief Creates a new instance of TcpSocket, giving up connecting after a timeout. Same as constructor but returns a Result
+         * \param remoteAddress Remote address to connect to
+         * \param remotePort Remote port to connect to
+         * \param connectTimeout Maximum time to wait for the connection to each address the remote address resolves to
+         * \return Either the newly created TcpSocket in case of success, or an error message otherwise
+         */
+        IKNET_EXPORT static ikgen::Result<TcpSocket, std::string> create(const std::string& remoteAddress, uint16_t remotePort,
+                                                                         std::chrono::milliseconds connectTimeout);
+
 
         /*!
          * \brief Constructor, throws std::runtime_error if a problem occurs
@@ -51,6 +62,16 @@ class TcpSocket : public Socket
          */
         IKNET_EXPORT TcpSocket(const std::string& remoteAddress, uint16_t remotePort);
 
+        /*!
+         * \brief Constructor giving up connecting after a timeout, throws std::runtime_error if a problem occurs
+         *
+         * The resolution of the remote address is not bounded by the timeout
+         * \param remoteAddress Remote address to connect to
+         * \param remotePort Remote port to connect to
+         * \param connectTimeout Maximum time to wait for the connection to each address the remote address resolves to
+         */
+        IKNET_EXPORT TcpSocket(const std::string& remoteAddress, uint16_t remotePort, std::chrono::milliseconds connectTimeout);
+
         /*!
          * \brief Constructor to wrap an existing socket of the underlying system type
          * \param socketImpl The socket to wrap
@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2023, InternationalKoder
+    Copyright (C) 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -40,6 +40,8 @@ struct addrinfo;
 namespace iknet
 {
 
+class AddrInfo;
+
 /*!
  * \brief A socket using UDP protocol
  */
@@ -75,6 +77,15 @@ class UdpSocket : public Socket
         IKNET_EXPORT ikgen::Result<size_t, std::string> send(const char* const buffer, size_t length,
                                                              const std::string& remoteAddress, uint16_t remotePort);
 
+        /*!
+         * \brief Sends the given buffer on the socket to an already resolved address, avoiding a resolution at each call
+         * \param buffer The buffer to send
+         * \param length The length of the buffer in bytes
+         * \param remoteAddress Remote address and port the buffer will be sent to, as given by AddrInfo::resolve
+         * \return Either the size of the effictively sent buffer in case of success, an error message otherwise
+         */
+        IKNET_EXPORT ikgen::Result<size_t, std::string> send(const char* const buffer, size_t length, AddrInfo& remoteAddress);
+
         /*!
          * \brief Send the given buffer on the socket
          * \param buffer The buffer to send
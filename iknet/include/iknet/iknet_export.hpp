@@ -0,0 +1,42 @@
+
+#ifndef IKNET_EXPORT_H
+#define IKNET_EXPORT_H
+
+#ifdef IKNET_BUILT_AS_STATIC
+#  define IKNET_EXPORT
+#  define IKNET_NO_EXPORT
+#else
+#  ifndef IKNET_EXPORT
+#    ifdef iknet_EXPORTS
+        /* We are building this library */
+#      define IKNET_EXPORT __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define IKNET_EXPORT __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef IKNET_NO_EXPORT
+#    define IKNET_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef IKNET_DEPRECATED
+#  define IKNET_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef IKNET_DEPRECATED_EXPORT
+#  define IKNET_DEPRECATED_EXPORT IKNET_EXPORT IKNET_DEPRECATED
+#endif
+
+#ifndef IKNET_DEPRECATED_NO_EXPORT
+#  define IKNET_DEPRECATED_NO_EXPORT IKNET_NO_EXPORT IKNET_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef IKNET_NO_DEPRECATED
+#    define IKNET_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* IKNET_EXPORT_H */
@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2023, InternationalKoder
+    Copyright (C) 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -22,8 +22,15 @@
 #include "iknet/systemspec.hpp"
 #include "iknet/SocketInitializer.hpp"
 
+#include <algorithm>
+#include <climits>
+
 #ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
 #include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
 #endif
 
 namespace iknet
@@ -34,6 +41,92 @@ using CreateResult = ikgen::Result<TcpSocket, std::string>;
 using IoResult = ikgen::Result<size_t, std::string>;
 using ReceiveResult = ikgen::Result<Buffer, std::string>;
 
+// a peer closing the connection has to give a sending error, instead of killing the process with SIGPIPE
+#ifdef MSG_NOSIGNAL
+static constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static constexpr int SEND_FLAGS = 0;
+#endif
+
+static constexpr std::chrono::milliseconds NO_CONNECT_TIMEOUT = std::chrono::milliseconds::max();
+
+
+namespace
+{
+    /*!
+     * \brief Connects a socket in non-blocking mode, waiting for the connection at most for a timeout
+     *
+     * The socket is put back in blocking mode once connected
+     * \param socket The socket to connect
+     * \param addr The address to connect to
+     * \param timeout The maximum time to wait for the connection
+     * \return 0 in case of success, the error code of the system otherwise
+     */
+    int connectWithTimeout(SocketImpl socket, const addrinfo* addr, std::chrono::milliseconds timeout)
+    {
+        const int timeoutMillis = static_cast<int>(std::clamp<std::chrono::milliseconds::rep>(timeout.count(), 0, INT_MAX));
+
+#ifdef _WIN32
+        u_long nonBlocking = 1;
+        ioctlsocket(socket, FIONBIO, &nonBlocking);
+
+        if(connect(socket, addr->ai_addr, static_cast<int>(addr->ai_addrlen)) != 0)
+        {
+            if(WSAGetLastError() != WSAEWOULDBLOCK)
+                return WSAGetLastError();
+
+            WSAPOLLFD pollInfo{socket, POLLOUT, 0};
+            const int pollResult = WSAPoll(&pollInfo, 1, timeoutMillis);
+            if(pollResult == 0)
+                return WSAETIMEDOUT;
+            if(pollResult < 0)
+                return WSAGetLastError();
+
+            int error = 0;
+            int errorLength = sizeof(error);
+            getsockopt(socket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &errorLength);
+            if(error != 0)
+                return error;
+        }
+
+        nonBlocking = 0;
+        ioctlsocket(socket, FIONBIO, &nonBlocking);
+#else
+        const int flags = fcntl(socket, F_GETFL, 0);
+        fcntl(socket, F_SETFL, flags | O_NONBLOCK);
+
+        if(connect(socket, addr->ai_addr, static_cast<socklen_t>(addr->ai_addrlen)) != 0)
+        {
+            if(errno != EINPROGRESS)
+                return errno;
+
+            pollfd pollInfo{socket, POLLOUT, 0};
+            int pollResult;
+            do
+            {
+                pollResult = poll(&pollInfo, 1, timeoutMillis);
+            } while(pollResult < 0 && errno == EINTR);
+
+            if(pollResult == 0)
+                return ETIMEDOUT;
+            if(pollResult < 0)
+                return errno;
+
+            int error = 0;
+            socklen_t errorLength = sizeof(error);
+            if(getsockopt(socket, SOL_SOCKET, SO_ERROR, &error, &errorLength) != 0)
+                return errno;
+            if(error != 0)
+                return error;
+        }
+
+        fcntl(socket, F_SETFL, flags);
+#endif
+
+        return 0;
+    }
+}
+
 
 CreateResult TcpSocket::create(const std::string& remoteAddress, uint16_t remotePort)
 {
@@ -47,7 +140,23 @@ CreateResult TcpSocket::create(const std::string& remoteAddress, uint16_t remote
     }
 }
 
-TcpSocket::TcpSocket(const std::string& remoteAddress, uint16_t remotePort)
+CreateResult TcpSocket::create(const std::string& remoteAddress, uint16_t remotePort, std::chrono::milliseconds connectTimeout)
+{
+    try
+    {
+        return CreateResult::makeSuccess(remoteAddress, remotePort, connectTimeout);
+    }
+    catch(const std::runtime_error& e)
+    {
+        return CreateResult::makeFailure(e.what());
+    }
+}
+
+TcpSocket::TcpSocket(const std::string& remoteAddress, uint16_t remotePort) :
+    TcpSocket(remoteAddress, remotePort, NO_CONNECT_TIMEOUT)
+{}
+
+TcpSocket::TcpSocket(const std::string& remoteAddress, uint16_t remotePort, std::chrono::milliseconds connectTimeout)
 {
     // Initialize
     priv::SocketInitializer::initializeSockets();
@@ -86,11 +195,21 @@ TcpSocket::TcpSocket(const std::string& remoteAddress, uint16_t remotePort)
 #endif
 
         // Connect
-        connectResult = connect(m_socketImpl, addr->ai_addr, static_cast<socklen_t>(addr->ai_addrlen));
+        if(connectTimeout == NO_CONNECT_TIMEOUT)
+        {
+            connectResult = connect(m_socketImpl, addr->ai_addr, static_cast<socklen_t>(addr->ai_addrlen));
+            if(connectResult != 0)
+                error = lastNetworkErrorString();
+        }
+        else
+        {
+            connectResult = connectWithTimeout(m_socketImpl, addr, connectTimeout);
+            if(connectResult != 0)
+                error = formatNetworkError(connectResult);
+        }
 
         if(connectResult != 0)
         {
-            error = lastNetworkErrorString();
             addr = addr->ai_next;
             iknet::closeSocket(m_socketImpl);
         }
@@ -114,9 +233,9 @@ TcpSocket::TcpSocket(SocketImpl socketImpl) :
 IoResult TcpSocket::send(const char* const buffer, size_t length)
 {
 #ifdef _WIN32
-    const IoSize sendResult = ::send(m_socketImpl, buffer, static_cast<int>(length), 0);
+    const IoSize sendResult = ::send(m_socketImpl, buffer, static_cast<int>(length), SEND_FLAGS);
 #else
-    const IoSize sendResult = ::send(m_socketImpl, buffer, length, 0);
+    const IoSize sendResult = ::send(m_socketImpl, buffer, length, SEND_FLAGS);
 #endif
 
     if(isSendError(sendResult))
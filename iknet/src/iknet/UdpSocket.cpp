@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2023, InternationalKoder
+    Copyright (C) 2023, 2026, InternationalKoder
 
     This file is part of IKLibs.
 
@@ -118,8 +118,11 @@ IoResult UdpSocket::send(const char* const buffer, size_t length, const std::str
     if(resolveRemoteAddrResult.isFailure())
         return IoResult::makeFailure(resolveRemoteAddrResult.getFailure());
 
-    AddrInfo& remoteAddr = resolveRemoteAddrResult.getSuccess();
+    return send(buffer, length, resolveRemoteAddrResult.getSuccess());
+}
 
+IoResult UdpSocket::send(const char* const buffer, size_t length, AddrInfo& remoteAddr)
+{
     // Send
     IoSize sendResult = iknet::DEFAULT_SOCKET_ERROR;
     addrinfo* addr = remoteAddr.getImpl();
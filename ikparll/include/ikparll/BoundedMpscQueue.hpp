@@ -0,0 +1,178 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKPARLL_BOUNDED_MPSC_QUEUE_HPP
+#define IKPARLL_BOUNDED_MPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace ikparll
+{
+    /*!
+     * \brief A bounded lock-free queue for multiple producers and a single consumer
+     *
+     * Each slot of the queue holds a sequence number telling whether it is ready to be written or read,
+     * so producers only compete on a single compare-and-swap and never wait for each other.
+     * The items are written and read in place, which allows to reuse resources held by them (e.g. the capacity of a std::string).
+     *
+     * Template arguments:
+     * - T is the type of the items stored in the queue, it must be default constructible
+     */
+    template<typename T>
+    class BoundedMpscQueue
+    {
+        public:
+
+            /*!
+             * \brief Constructor
+             * \param capacity The maximum number of items in the queue, rounded up to the next power of two
+             */
+            explicit BoundedMpscQueue(size_t capacity) :
+                m_mask(roundCapacity(capacity) - 1),
+                m_cells(std::make_unique<Cell[]>(m_mask + 1)),
+                m_enqueuePosition(0),
+                m_dequeuePosition(0)
+            {
+                for(size_t i = 0 ; i <= m_mask ; i++)
+                    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+            BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+
+            /*!
+             * \brief Adds an item to the queue if there is room for it, can be called from any thread
+             * \param writer Function receiving a reference to the item of the reserved slot, and filling it. If it throws,
+             * the slot is skipped by the consumer and the exception is rethrown
+             * \return True if the item has been added, false if the queue is full
+             */
+            template<typename F>
+            bool tryPush(F&& writer)
+            {
+                Cell* cell;
+                size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+                while(true)
+                {
+                    cell = &m_cells[position & m_mask];
+                    const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                    const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+                    if(difference == 0)
+                    {
+                        // the slot is free, try to reserve it
+                        if(m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if(difference < 0)
+                        return false; // the slot has not been consumed yet: the queue is full
+                    else
+                        position = m_enqueuePosition.load(std::memory_order_relaxed);
+                }
+
+                try
+                {
+                    writer(cell->item);
+                }
+                catch(...)
+                {
+                    // the reserved slot has to be published anyway, otherwise the consumer would wait for it forever
+                    cell->skipped = true;
+                    cell->sequence.store(position + 1, std::memory_order_release);
+                    throw;
+                }
+
+                cell->sequence.store(position + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            /*!
+             * \brief Consumes the oldest item of the queue if there is one, must only be called from the consumer thread
+             * \param reader Function receiving a reference to the oldest item
+             * \return True if an item has been consumed, false if the queue is empty
+             */
+            template<typename F>
+            bool tryPop(F&& reader)
+            {
+                while(true)
+                {
+                    Cell& cell = m_cells[m_dequeuePosition & m_mask];
+
+                    if(cell.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1)
+                        return false;
+
+                    const bool skipped = cell.skipped;
+                    if(!skipped)
+                        reader(cell.item);
+
+                    cell.skipped = false;
+                    cell.sequence.store(m_dequeuePosition + m_mask + 1, std::memory_order_release);
+                    m_dequeuePosition++;
+
+                    if(!skipped)
+                        return true;
+                }
+            }
+
+            /*!
+             * \brief Gives the number of items the queue can hold
+             * \return The capacity of the queue
+             */
+            inline size_t getCapacity() const { return m_mask + 1; }
+
+        private:
+
+            static constexpr size_t CACHE_LINE_SIZE = 64; // avoids false sharing between the producers and the consumer
+
+            /*!
+             * \brief A slot of the queue
+             */
+            struct alignas(CACHE_LINE_SIZE) Cell
+            {
+                std::atomic<size_t> sequence; // tells whether the slot is free or filled, relatively to the enqueue and dequeue positions
+                bool skipped = false; // set when the writer of the item has thrown, so the consumer discards it
+                T item;
+            };
+
+            /*!
+             * \brief Rounds the capacity up to a power of two, so positions can be wrapped with a mask
+             * \param capacity The requested capacity
+             * \return The actual capacity
+             */
+            static size_t roundCapacity(size_t capacity)
+            {
+                size_t rounded = 2;
+                while(rounded < capacity)
+                    rounded <<= 1;
+                return rounded;
+            }
+
+
+            const size_t m_mask; // mask to get the index of a slot from a position
+            const std::unique_ptr<Cell[]> m_cells; // slots of the queue
+
+            alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_enqueuePosition; // next position to write to, shared by the producers
+            alignas(CACHE_LINE_SIZE) size_t m_dequeuePosition; // next position to read from, owned by the consumer
+    };
+}
+
+#endif // IKPARLL_BOUNDED_MPSC_QUEUE_HPP
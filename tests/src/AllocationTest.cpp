@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TestCheck.hpp"
+#include <iklog/Log.hpp>
+#include <iklog/outputs/OstreamWrapper.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+/*
+ * Once the buffers of the logging thread have grown, logging a message does not allocate any memory,
+ * whether it is formatted from arguments, plain, or has fields
+ */
+
+namespace
+{
+    std::atomic<bool> countingAllocations(false);
+    std::atomic<size_t> allocationCount(0);
+
+    /*!
+     * \brief Stream buffer discarding everything, so that the stream does not allocate either
+     */
+    class NullBuffer : public std::streambuf
+    {
+        protected:
+
+            virtual int overflow(int character) override { return character; }
+            virtual std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    };
+
+    void* allocate(std::size_t size)
+    {
+        if(countingAllocations.load(std::memory_order_relaxed))
+            allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        void* memory = std::malloc(size == 0 ? 1 : size);
+        if(memory == nullptr)
+            throw std::bad_alloc();
+        return memory;
+    }
+
+    void logMessages(const iklog::Log& log, const std::string& path)
+    {
+        for(int i = 0 ; i < 100 ; i++)
+        {
+            log.info("formatted message {} of {} with {}", i, path, 0.5 * i);
+            log.warn("plain message that is long enough not to fit in the small string buffer of the library");
+            log.info("field message", {{"path", path}, {"attempt", i}, {"ratio", 0.25}, {"retry", true}});
+        }
+    }
+}
+
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+
+int main()
+{
+    NullBuffer nullBuffer;
+    std::ostream stream(&nullBuffer);
+    iklog::OstreamWrapper output(stream);
+    iklog::Log log("allocation", iklog::levelsFrom(iklog::Level::DEBUG), output);
+    const std::string path = "/a/path/long/enough/not/to/fit/in/the/small/string/buffer";
+
+    // lets the buffers of this thread grow
+    logMessages(log, path);
+
+    countingAllocations = true;
+    logMessages(log, path);
+    countingAllocations = false;
+
+    TEST_CHECK(allocationCount == 0);
+
+    return getTestResult();
+}
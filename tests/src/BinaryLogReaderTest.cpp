@@ -0,0 +1,147 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TestCheck.hpp"
+#include <iklog/binary/BinaryLog.hpp>
+#include <iklog/binary/BinaryLogReader.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+/*
+ * Binary log files are decoded from untrusted bytes: a truncated or corrupted file must give a failure,
+ * never a huge allocation or a crash
+ */
+
+namespace
+{
+    const std::filesystem::path DIRECTORY = std::filesystem::temp_directory_path() / "iklibs-test-binary-log-reader";
+
+    std::string readFile(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+        std::ostringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    std::string writeFile(const std::string& name, const std::string& content)
+    {
+        const std::filesystem::path path = DIRECTORY / name;
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        return path.string();
+    }
+
+    std::string makeHeader()
+    {
+        std::string header(iklog::internal::binary::MAGIC, sizeof(iklog::internal::binary::MAGIC));
+        header += static_cast<char>(iklog::internal::binary::VERSION);
+        iklog::internal::appendVarint(header, 4);
+        header += "test";
+        iklog::internal::appendVarint(header, 0);
+        return header;
+    }
+
+    bool isDecodingFailing(const std::string& filename)
+    {
+        auto createResult = iklog::BinaryLogReader::create(filename);
+        if(createResult.isFailure())
+            return true;
+
+        std::ostringstream output;
+        return createResult.getSuccess().decode(iklog::Formatter("%m"), output).isFailure();
+    }
+}
+
+int main()
+{
+    std::filesystem::remove_all(DIRECTORY);
+    std::filesystem::create_directories(DIRECTORY);
+
+    const std::filesystem::path validFile = DIRECTORY / "valid.bin";
+    {
+        iklog::BinaryLog log("test", iklog::levelsFrom(iklog::Level::DEBUG), validFile.string());
+        IKLOG_BINARY_LOG(log, iklog::Level::INFO, "Received {} bytes from {}", 42, "localhost");
+        IKLOG_BINARY_LOG(log, iklog::Level::DEBUG, "Done in {} ms", 1.5);
+
+        const char* nullString = nullptr;
+        IKLOG_BINARY_LOG(log, iklog::Level::INFO, "Null string {}", nullString);
+    }
+
+    // the valid file is decoded entirely
+    {
+        auto createResult = iklog::BinaryLogReader::create(validFile.string());
+        TEST_CHECK(createResult.isSuccess());
+        if(createResult.isSuccess())
+        {
+            std::ostringstream output;
+            auto decodeResult = createResult.getSuccess().decode(iklog::Formatter("%m"), output);
+            TEST_CHECK(decodeResult.isSuccess() && decodeResult.getSuccess() == 3);
+            TEST_CHECK(output.str() == "Received 42 bytes from localhost\nDone in 1.5 ms\nNull string (null)\n");
+        }
+    }
+
+    // every truncation of the valid file fails, except at the end of a record
+    const std::string validContent = readFile(validFile);
+    TEST_CHECK(isDecodingFailing(writeFile("truncated.bin", validContent.substr(0, validContent.size() - 1))));
+    TEST_CHECK(isDecodingFailing(writeFile("truncated-header.bin", validContent.substr(0, 7))));
+
+    // a string length beyond the end of the file
+    std::string content = makeHeader();
+    content += static_cast<char>(iklog::internal::binary::FORMAT_RECORD);
+    iklog::internal::appendVarint(content, 1);
+    iklog::internal::appendVarint(content, uint64_t(1) << 60);
+    content += "{}";
+    TEST_CHECK(isDecodingFailing(writeFile("huge-format.bin", content)));
+
+    // a log name length beyond the end of the file
+    content = makeHeader().substr(0, sizeof(iklog::internal::binary::MAGIC) + 1);
+    iklog::internal::appendVarint(content, UINT64_MAX);
+    content += "test";
+    TEST_CHECK(isDecodingFailing(writeFile("huge-name.bin", content)));
+
+    // a format identifier far above any registered format
+    content = makeHeader();
+    content += static_cast<char>(iklog::internal::binary::FORMAT_RECORD);
+    iklog::internal::appendVarint(content, uint64_t(1) << 40);
+    iklog::internal::appendVarint(content, 2);
+    content += "{}";
+    TEST_CHECK(isDecodingFailing(writeFile("huge-format-id.bin", content)));
+
+    // a string argument length beyond the end of the file
+    content = makeHeader();
+    content += static_cast<char>(iklog::internal::binary::FORMAT_RECORD);
+    iklog::internal::appendVarint(content, iklog::internal::binary::RAW_MESSAGE_FORMAT);
+    iklog::internal::appendVarint(content, 2);
+    content += "{}";
+    content += static_cast<char>(iklog::internal::binary::EVENT_RECORD);
+    iklog::internal::appendVarint(content, iklog::internal::binary::RAW_MESSAGE_FORMAT);
+    iklog::internal::appendVarint(content, iklog::Level::INFO);
+    iklog::internal::appendVarint(content, 0);
+    content += static_cast<char>(1);
+    content += static_cast<char>(iklog::internal::BinaryType::STRING);
+    iklog::internal::appendVarint(content, uint64_t(1) << 50);
+    content += "text";
+    TEST_CHECK(isDecodingFailing(writeFile("huge-argument.bin", content)));
+
+    std::filesystem::remove_all(DIRECTORY);
+
+    return getTestResult();
+}
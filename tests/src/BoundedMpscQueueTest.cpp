@@ -0,0 +1,64 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TestCheck.hpp"
+#include <ikparll/BoundedMpscQueue.hpp>
+#include <stdexcept>
+
+/*
+ * A writer throwing an exception does not block the queue: its slot is skipped by the consumer and freed
+ */
+
+int main()
+{
+    ikparll::BoundedMpscQueue<int> queue(4);
+    int popped = 0;
+    const auto readItem = [&popped](int item) { popped = item; };
+
+    TEST_CHECK(queue.tryPush([](int& item) { item = 1; }));
+
+    bool thrown = false;
+    try
+    {
+        queue.tryPush([](int&) { throw std::runtime_error("writer failure"); });
+    }
+    catch(const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    TEST_CHECK(thrown);
+
+    TEST_CHECK(queue.tryPush([](int& item) { item = 3; }));
+
+    // the item of the throwing writer is never read
+    TEST_CHECK(queue.tryPop(readItem) && popped == 1);
+    TEST_CHECK(queue.tryPop(readItem) && popped == 3);
+    TEST_CHECK(!queue.tryPop(readItem));
+
+    // the skipped slot is available again
+    for(int i = 0 ; i < 4 ; i++)
+        TEST_CHECK(queue.tryPush([i](int& item) { item = i; }));
+    TEST_CHECK(!queue.tryPush([](int& item) { item = -1; }));
+
+    for(int i = 0 ; i < 4 ; i++)
+        TEST_CHECK(queue.tryPop(readItem) && popped == i);
+    TEST_CHECK(!queue.tryPop(readItem));
+
+    return getTestResult();
+}
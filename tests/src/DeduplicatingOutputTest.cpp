@@ -0,0 +1,108 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TestCheck.hpp"
+#include <iklog/Log.hpp>
+#include <iklog/outputs/DeduplicatingOutput.hpp>
+#include <iklog/outputs/OstreamWrapper.hpp>
+#include <sstream>
+#include <string>
+
+/*
+ * Identical messages are collapsed even when their formatted lines differ by their time,
+ * including messages with structured fields
+ */
+
+namespace
+{
+    std::string deduplicate(const iklog::Formatter& formatter, void (*logMessages)(iklog::Log&))
+    {
+        std::ostringstream stream;
+        iklog::OstreamWrapper streamOutput(stream);
+
+        {
+            iklog::DeduplicatingOutput output(streamOutput, std::chrono::hours(1));
+            iklog::Log log("deduplication", iklog::levelsFrom(iklog::Level::DEBUG), output, formatter);
+            logMessages(log);
+        }
+
+        return stream.str();
+    }
+
+    size_t countLines(const std::string& text)
+    {
+        size_t count = 0;
+        for(char character : text)
+        {
+            if(character == '\n')
+                count++;
+        }
+        return count;
+    }
+
+    void logPlainMessages(iklog::Log& log)
+    {
+        for(int i = 0 ; i < 5 ; i++)
+            log.info("plain");
+    }
+
+    void logFieldMessages(iklog::Log& log)
+    {
+        for(int i = 0 ; i < 5 ; i++)
+            log.log(iklog::Level::INFO, "same", {{"k", 1}, {"path", "/retry"}});
+    }
+
+    void logDifferentFieldMessages(iklog::Log& log)
+    {
+        log.log(iklog::Level::INFO, "same", {{"k", 1}});
+        log.log(iklog::Level::INFO, "same", {{"k", 2}});
+        log.log(iklog::Level::INFO, "same", {{"k", "1"}});
+        log.log(iklog::Level::INFO, "same", {{"other", 1}});
+        log.log(iklog::Level::INFO, "same", {{"other", 1}, {"k", 1}});
+        log.log(iklog::Level::INFO, "same");
+    }
+}
+
+int main()
+{
+    // the time with microseconds makes each formatted line different
+    const iklog::Formatter textFormatter("%U %L %m %F");
+
+    const std::string plain = deduplicate(textFormatter, &logPlainMessages);
+    TEST_CHECK(countLines(plain) == 2);
+    TEST_CHECK(plain.find("Last message repeated 4 times") != std::string::npos);
+
+    const std::string fields = deduplicate(textFormatter, &logFieldMessages);
+    TEST_CHECK(countLines(fields) == 2);
+    TEST_CHECK(fields.find("k=1 path=/retry") != std::string::npos);
+    TEST_CHECK(fields.find("Last message repeated 4 times") != std::string::npos);
+
+    const std::string json = deduplicate(iklog::Formatter(iklog::Formatter::Style::JSON), &logFieldMessages);
+    TEST_CHECK(countLines(json) == 2);
+
+    const std::string logfmt = deduplicate(iklog::Formatter(iklog::Formatter::Style::LOGFMT), &logFieldMessages);
+    TEST_CHECK(countLines(logfmt) == 2);
+
+    // fields with another key, value, type or count start a new series
+    const std::string differentFields = deduplicate(textFormatter, &logDifferentFieldMessages);
+    TEST_CHECK(countLines(differentFields) == 6);
+    TEST_CHECK(differentFields.find("repeated") == std::string::npos);
+
+    return getTestResult();
+}
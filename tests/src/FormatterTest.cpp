@@ -0,0 +1,48 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TestCheck.hpp"
+#include <iklog/Formatter.hpp>
+#include <iklog/Message.hpp>
+#include <chrono>
+
+/*
+ * The duration from the creation of the Log is printed as hours, minutes and seconds, a negative duration
+ * given by a clock going backward being printed as zero
+ */
+
+namespace
+{
+    std::string formatDuration(iklog::Message::Duration duration)
+    {
+        const iklog::Message message("formatter", iklog::Level::INFO, "", duration, std::chrono::system_clock::now());
+        return iklog::Formatter("%d").format(message);
+    }
+}
+
+int main()
+{
+    TEST_CHECK(formatDuration(std::chrono::seconds(0)) == "0:00:00");
+    TEST_CHECK(formatDuration(std::chrono::hours(27) + std::chrono::minutes(4) + std::chrono::seconds(9)) == "27:04:09");
+    TEST_CHECK(formatDuration(std::chrono::milliseconds(-300)) == "0:00:00");
+    TEST_CHECK(formatDuration(std::chrono::seconds(-90)) == "0:00:00");
+    TEST_CHECK(formatDuration(std::chrono::hours(-5)) == "0:00:00");
+
+    return getTestResult();
+}
@@ -0,0 +1,58 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TestCheck.hpp"
+#include <iklog/Log.hpp>
+#include <iklog/outputs/OstreamWrapper.hpp>
+#include <sstream>
+
+/*
+ * Arguments of formatted messages, including the ones that are valid but unusual, like a null C string
+ */
+
+int main()
+{
+    std::ostringstream stream;
+    iklog::OstreamWrapper output(stream);
+    iklog::Log log("message-format", iklog::levelsFrom(iklog::Level::DEBUG), output, iklog::Formatter("%m"));
+
+    const char* nullString = nullptr;
+    char* nullMutableString = nullptr;
+    char text[] = "text";
+    const int value = 42;
+
+    log.info("p={}", nullString);
+    log.info("p={}", nullMutableString);
+    log.info("s={} {}", static_cast<const char*>(text), text);
+    log.info("{} {} {} {}", true, 'c', -7, 1.5);
+    log.info("{} and {} but not {}", "one", std::string("two"));
+    log.info("pointer {}", &value);
+
+    std::istringstream lines(stream.str());
+    std::string line;
+
+    TEST_CHECK(std::getline(lines, line) && line == "p=(null)");
+    TEST_CHECK(std::getline(lines, line) && line == "p=(null)");
+    TEST_CHECK(std::getline(lines, line) && line == "s=text text");
+    TEST_CHECK(std::getline(lines, line) && line == "true c -7 1.5");
+    TEST_CHECK(std::getline(lines, line) && line == "one and two but not {}");
+    TEST_CHECK(std::getline(lines, line) && line.rfind("pointer 0x", 0) == 0);
+
+    return getTestResult();
+}
@@ -0,0 +1,125 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TestCheck.hpp"
+#include <iklog/Log.hpp>
+#include <iklog/RateLimiter.hpp>
+#include <iklog/outputs/OstreamWrapper.hpp>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+/*
+ * Token buckets are created from any rate, including the edge values: the interval between two messages is clamped
+ * instead of overflowing. The suppressed messages are reported even when no message is let through after them
+ */
+
+namespace
+{
+    int countAcquired(iklog::RateLimiter& limiter, int messageCount)
+    {
+        int acquired = 0;
+        for(int i = 0 ; i < messageCount ; i++)
+        {
+            if(limiter.tryAcquire())
+                acquired++;
+        }
+        return acquired;
+    }
+}
+
+int main()
+{
+    // rates too low to let another message through: only the burst passes
+    iklog::RateLimiter zeroRate = iklog::RateLimiter::tokenBucket(0, 3);
+    TEST_CHECK(countAcquired(zeroRate, 100) == 3);
+
+    iklog::RateLimiter negativeRate = iklog::RateLimiter::tokenBucket(-5, 1);
+    TEST_CHECK(countAcquired(negativeRate, 100) == 1);
+
+    iklog::RateLimiter nanRate = iklog::RateLimiter::tokenBucket(std::nan(""), 2);
+    TEST_CHECK(countAcquired(nanRate, 100) == 2);
+
+    iklog::RateLimiter tinyRate = iklog::RateLimiter::tokenBucket(1e-300, 2);
+    TEST_CHECK(countAcquired(tinyRate, 100) == 2);
+
+    // the largest burst does not overflow the tolerance, it is only bounded when the interval is very long
+    iklog::RateLimiter largestBurst = iklog::RateLimiter::tokenBucket(1, std::numeric_limits<unsigned int>::max());
+    TEST_CHECK(countAcquired(largestBurst, 1000) == 1000);
+
+    iklog::RateLimiter largestBurstZeroRate = iklog::RateLimiter::tokenBucket(0, std::numeric_limits<unsigned int>::max());
+    const int acquiredWithZeroRate = countAcquired(largestBurstZeroRate, 1000);
+    TEST_CHECK(acquiredWithZeroRate > 1 && acquiredWithZeroRate < 1000);
+
+    // a rate above one message per nanosecond lets everything through
+    iklog::RateLimiter hugeRate = iklog::RateLimiter::tokenBucket(1e300, 1000);
+    TEST_CHECK(countAcquired(hugeRate, 100) == 100);
+
+    iklog::RateLimiter infiniteRate = iklog::RateLimiter::tokenBucket(std::numeric_limits<double>::infinity(), 1000);
+    TEST_CHECK(countAcquired(infiniteRate, 100) == 100);
+
+    // the suppressed messages are reported once
+    iklog::RateLimiter summarized = iklog::RateLimiter::tokenBucket(0, 1, std::chrono::milliseconds(0));
+    TEST_CHECK(summarized.takeSummary() == 0);
+    TEST_CHECK(countAcquired(summarized, 10) == 1);
+    TEST_CHECK(summarized.takeSummary() == 9);
+    TEST_CHECK(summarized.takeSummary() == 0);
+
+    iklog::RateLimiter sampled = iklog::RateLimiter::sampling(4, std::chrono::milliseconds(0));
+    TEST_CHECK(countAcquired(sampled, 8) == 2);
+    TEST_CHECK(sampled.takeSummary() == 6);
+    TEST_CHECK(sampled.takeSummary() == 0);
+
+    // the end of a storm is reported by the background thread
+    {
+        std::ostringstream stream;
+        iklog::OstreamWrapper output(stream);
+        iklog::Log log("rate-limiter", iklog::levelsFrom(iklog::Level::DEBUG), output, iklog::Formatter("%m"));
+        iklog::RateLimiter limiter = iklog::RateLimiter::tokenBucket(0, 1, std::chrono::milliseconds(10));
+        log.setRateLimiter(limiter);
+
+        for(int i = 0 ; i < 10 ; i++)
+            log.info("storm message");
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        log.removeRateLimiter();
+
+        TEST_CHECK(stream.str() == "storm message\n9 messages suppressed by rate limiting\n");
+    }
+
+    // and by the destruction of the Log, whatever the summary interval
+    {
+        std::ostringstream stream;
+        iklog::OstreamWrapper output(stream);
+        iklog::RateLimiter limiter = iklog::RateLimiter::tokenBucket(0, 1, std::chrono::hours(1));
+
+        {
+            iklog::Log log("rate-limiter", iklog::levelsFrom(iklog::Level::DEBUG), output, iklog::Formatter("%m"));
+            log.setRateLimiter(limiter);
+
+            for(int i = 0 ; i < 10 ; i++)
+                log.info("storm message");
+        }
+
+        TEST_CHECK(stream.str() == "storm message\n9 messages suppressed by rate limiting\n");
+    }
+
+    return getTestResult();
+}
@@ -0,0 +1,72 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TestCheck.hpp"
+#include <iklog/Log.hpp>
+#include <iklog/outputs/MappedFileOutput.hpp>
+#include <iklog/outputs/OstreamWrapper.hpp>
+#include <iklog/outputs/RollingFileOutput.hpp>
+#include <filesystem>
+#include <sstream>
+
+/*
+ * Static outputs with a periodic flush policy are destroyed at exit, after main returns: they must still be able
+ * to stop their periodic flush and wait for their background file operations
+ */
+
+namespace
+{
+    const std::filesystem::path DIRECTORY = std::filesystem::temp_directory_path() / "iklibs-test-static-outputs";
+
+    std::filesystem::path createDirectory()
+    {
+        std::filesystem::remove_all(DIRECTORY);
+        std::filesystem::create_directories(DIRECTORY);
+        return DIRECTORY;
+    }
+
+    const std::filesystem::path directory = createDirectory();
+
+    std::ostringstream stream;
+    iklog::OstreamWrapper streamOutput(stream);
+    iklog::RollingFileOutput rollingOutput((directory / "rolling.log").string(), iklog::Bytes(256), 3);
+    iklog::MappedFileOutput mappedOutput((directory / "mapped.log").string(), iklog::KiloBytes(4), 3);
+}
+
+int main()
+{
+    const iklog::FlushPolicy periodic = iklog::FlushPolicy::periodic(std::chrono::milliseconds(1));
+    streamOutput.setFlushPolicy(periodic);
+    rollingOutput.setFlushPolicy(periodic);
+    mappedOutput.setFlushPolicy(periodic);
+    iklog::OstreamWrapper::COUT.setFlushPolicy(periodic);
+
+    iklog::Log log("static-outputs", iklog::levelsFrom(iklog::Level::DEBUG), streamOutput);
+    log.addOutput(rollingOutput);
+    log.addOutput(mappedOutput);
+
+    // rolls the files several times, so background file operations may be pending at exit
+    for(int i = 0 ; i < 200 ; i++)
+        log.info("static output message {}", i);
+
+    TEST_CHECK(stream.str().find("static output message 199") != std::string::npos);
+    TEST_CHECK(std::filesystem::exists(directory / "rolling.log.0"));
+
+    return getTestResult();
+}
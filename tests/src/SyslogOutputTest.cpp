@@ -0,0 +1,172 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TestCheck.hpp"
+#include <iklog/Log.hpp>
+#include <iklognet/SyslogOutput.hpp>
+#include <iknet/UdpSocket.hpp>
+#include <memory>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+ * The records sent to a collector have a RFC 5424 header, they are packed in datagrams which never exceed the maximum
+ * size, or sent one per datagram when packing is disabled. A record longer than a datagram is truncated after its header
+ */
+
+namespace
+{
+    constexpr uint16_t FIRST_PORT = 51514;
+    constexpr uint16_t PORT_COUNT = 100;
+    constexpr size_t MESSAGE_COUNT = 20;
+
+    struct Collector
+    {
+        std::unique_ptr<iknet::UdpSocket> socket;
+        uint16_t port = 0;
+    };
+
+    Collector createCollector()
+    {
+        Collector collector;
+        for(uint16_t port = FIRST_PORT ; port < FIRST_PORT + PORT_COUNT && !collector.socket ; port++)
+        {
+            try
+            {
+                collector.socket = std::make_unique<iknet::UdpSocket>("127.0.0.1", port);
+                collector.port = port;
+            }
+            catch(const std::runtime_error&)
+            {}
+        }
+
+        return collector;
+    }
+
+    /*!
+     * \brief Logs the messages to a new SyslogOutput, which sends its remaining records when it is destroyed,
+     * then returns the datagrams received by the collector
+     */
+    std::vector<std::string> collect(Collector& collector, size_t maxDatagramSize, bool packRecords,
+                                     const std::vector<std::string>& messages)
+    {
+        {
+            iklognet::SyslogOutput output("127.0.0.1", collector.port, "syslogtest", iklognet::SyslogOutput::Facility::LOCAL0,
+                                          maxDatagramSize, iklognet::SyslogOutput::DEFAULT_BUFFER_CAPACITY,
+                                          iklognet::SyslogOutput::DEFAULT_SEND_INTERVAL, packRecords);
+            iklog::Log log("records", iklog::levelsFrom(iklog::Level::DEBUG), output, iklog::Formatter("%m"));
+
+            for(const std::string& message : messages)
+                log.info(message);
+        }
+
+        std::vector<std::string> datagrams;
+        std::vector<char> buffer(65536);
+        collector.socket->setBlocking(false);
+        while(true)
+        {
+            auto receiveResult = collector.socket->receive(buffer.data(), buffer.size());
+            if(receiveResult.isFailure())
+                break;
+
+            datagrams.emplace_back(buffer.data(), receiveResult.getSuccess().getLength());
+        }
+        collector.socket->setBlocking(true);
+
+        return datagrams;
+    }
+
+    std::vector<std::string> splitRecords(const std::vector<std::string>& datagrams)
+    {
+        std::vector<std::string> records;
+        for(const std::string& datagram : datagrams)
+        {
+            size_t start = 0;
+            while(start < datagram.size())
+            {
+                const size_t end = datagram.find('\n', start);
+                records.push_back(datagram.substr(start, end == std::string::npos ? std::string::npos : end - start));
+                start = end == std::string::npos ? datagram.size() : end + 1;
+            }
+        }
+        return records;
+    }
+
+    std::vector<std::string> makeMessages()
+    {
+        std::vector<std::string> messages;
+        for(size_t i = 0 ; i < MESSAGE_COUNT ; i++)
+            messages.push_back("message " + std::to_string(i) + " " + std::string(60, 'x'));
+        return messages;
+    }
+
+    bool hasHeader(const std::string& record, const std::string& message)
+    {
+        // facility LOCAL0 and severity INFO give the priority 16 * 8 + 6
+        static const std::regex header(R"(<134>1 \d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{6}Z [!-~]+ syslogtest \d+ records - (.*))");
+
+        std::smatch match;
+        return std::regex_match(record, match, header) && match[1] == message;
+    }
+}
+
+int main()
+{
+    Collector collector = createCollector();
+    TEST_CHECK(collector.socket != nullptr);
+    if(!collector.socket)
+        return getTestResult();
+
+    const std::vector<std::string> messages = makeMessages();
+
+    // several records per datagram, each one ending with a line feed
+    const size_t packedSize = iklognet::SyslogOutput::MIN_DATAGRAM_SIZE;
+    const std::vector<std::string> packed = collect(collector, packedSize, true, messages);
+    TEST_CHECK(packed.size() > 1 && packed.size() < MESSAGE_COUNT);
+    for(const std::string& datagram : packed)
+        TEST_CHECK(datagram.size() <= packedSize && !datagram.empty() && datagram.back() == '\n');
+
+    const std::vector<std::string> packedRecords = splitRecords(packed);
+    TEST_CHECK(packedRecords.size() == MESSAGE_COUNT);
+    for(size_t i = 0 ; i < packedRecords.size() && i < MESSAGE_COUNT ; i++)
+        TEST_CHECK(hasHeader(packedRecords[i], messages[i]));
+
+    // one record per datagram, without line ending
+    const std::vector<std::string> unpacked = collect(collector, iklognet::SyslogOutput::DEFAULT_MAX_DATAGRAM_SIZE, false, messages);
+    TEST_CHECK(unpacked.size() == MESSAGE_COUNT);
+    for(size_t i = 0 ; i < unpacked.size() && i < MESSAGE_COUNT ; i++)
+        TEST_CHECK(hasHeader(unpacked[i], messages[i]));
+
+    // a too small maximum size is raised so that a truncated record keeps its header
+    const std::string longMessage(1000, 'y');
+    const std::vector<std::string> truncated = collect(collector, 1, false, {longMessage});
+    TEST_CHECK(truncated.size() == 1);
+    if(!truncated.empty())
+    {
+        TEST_CHECK(truncated[0].size() == iklognet::SyslogOutput::MIN_DATAGRAM_SIZE - 1);
+        const size_t textStart = truncated[0].find(" - ");
+        TEST_CHECK(textStart != std::string::npos);
+        if(textStart != std::string::npos)
+            TEST_CHECK(hasHeader(truncated[0], truncated[0].substr(textStart + 3)));
+    }
+
+    return getTestResult();
+}
@@ -0,0 +1,58 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IKLIBS_TESTS_TEST_CHECK_HPP
+#define IKLIBS_TESTS_TEST_CHECK_HPP
+
+#include <cstdlib>
+#include <iostream>
+
+/*!
+ * \brief Number of failed checks of the test program
+ */
+inline int& getFailedCheckCount()
+{
+    static int failedCheckCount = 0;
+    return failedCheckCount;
+}
+
+/*!
+ * \brief Checks a condition, printing it with its location if it is false
+ * \param condition The condition that must be true
+ */
+#define TEST_CHECK(condition) \
+    do \
+    { \
+        if(!(condition)) \
+        { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl; \
+            getFailedCheckCount()++; \
+        } \
+    } while(false)
+
+/*!
+ * \brief Gives the exit code of the test program
+ * \return EXIT_SUCCESS if all the checks passed
+ */
+inline int getTestResult()
+{
+    return getFailedCheckCount() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#endif // IKLIBS_TESTS_TEST_CHECK_HPP
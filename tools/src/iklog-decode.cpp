@@ -0,0 +1,56 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <iklog/binary/BinaryLogReader.hpp>
+#include <iostream>
+
+/*!
+ * \brief Turns a file written by a iklog::BinaryLog into text
+ *
+ * Usage: iklog-decode <binary log file> [format]
+ * The format uses the same fields as iklog::Formatter, the default format of iklog::Formatter is used when it is not given
+ */
+int main(int argc, char** argv)
+{
+    if(argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <binary log file> [format]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto createReaderResult = iklog::BinaryLogReader::create(argv[1]);
+    if(createReaderResult.isFailure())
+    {
+        std::cerr << createReaderResult.getFailure() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const iklog::Formatter formatter = argc == 3 ? iklog::Formatter(argv[2]) : iklog::Formatter();
+    const auto decodeResult = createReaderResult.getSuccess().decode(formatter, std::cout);
+
+    std::cout.flush();
+
+    if(decodeResult.isFailure())
+    {
+        std::cerr << decodeResult.getFailure() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
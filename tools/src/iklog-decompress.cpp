@@ -0,0 +1,64 @@
+/*
+    Copyright (C) 2026, InternationalKoder
+
+    This file is part of IKLibs.
+
+    IKLibs is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IKLibs is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with IKLibs.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <iklog/compression/LzCompression.hpp>
+#include <fstream>
+#include <iostream>
+
+/*!
+ * \brief Decompresses a file compressed by iklog, like the rolled files of iklog::RollingFileOutput
+ *
+ * Usage: iklog-decompress <compressed file> [output file]
+ * The decompressed data is written to the standard output when no output file is given
+ */
+int main(int argc, char** argv)
+{
+    if(argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <compressed file> [output file]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream input(argv[1], std::ios::in | std::ios::binary);
+    if(!input.is_open())
+    {
+        std::cerr << "Failed to open file '" << argv[1] << "' in read mode" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream outputFile;
+    if(argc == 3)
+    {
+        outputFile.open(argv[2], std::ios::out | std::ios::binary | std::ios::trunc);
+        if(!outputFile.is_open())
+        {
+            std::cerr << "Failed to open file '" << argv[2] << "' in write mode" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    const auto decompressResult = iklog::lz::decompress(input, argc == 3 ? static_cast<std::ostream&>(outputFile) : std::cout);
+    if(decompressResult.isFailure())
+    {
+        std::cerr << decompressResult.getFailure() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}